@@ -0,0 +1,202 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/.git/HEAD"
+  "/root/repo/.git/refs/heads/master"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/git-data/grabRef.cmake"
+  "/root/repo/apps/CMakeLists.txt"
+  "/root/repo/apps/convex_hull/CMakeLists.txt"
+  "/root/repo/apps/merge_fractions/CMakeLists.txt"
+  "/root/repo/apps/pipelining_datastructures/CMakeLists.txt"
+  "/root/repo/apps/pipelining_passive_sorter/CMakeLists.txt"
+  "/root/repo/apps/siv_dump/CMakeLists.txt"
+  "/root/repo/apps/unique/CMakeLists.txt"
+  "/root/repo/cmake_modules/FindLZ4.cmake"
+  "/root/repo/cmake_modules/FindSnappy.cmake"
+  "/root/repo/cmake_modules/FindZSTD.cmake"
+  "/root/repo/cmake_modules/GetGitRevisionDescription.cmake"
+  "/root/repo/cmake_modules/GetGitRevisionDescription.cmake.in"
+  "/root/repo/cmake_modules/LibFindSimpleLibrary.cmake"
+  "/root/repo/doc/CMakeLists.txt"
+  "/root/repo/doc/madalgo-doxygen.css"
+  "/root/repo/doc/pipelining_memory.png"
+  "/root/repo/doc/pipelining_sequence.png"
+  "/root/repo/doc/pipelining_sequence_pull.png"
+  "/root/repo/doc/printstyle.css"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/speed_regression/CMakeLists.txt"
+  "/root/repo/test/unit/CMakeLists.txt"
+  "/root/repo/test/unit/tpie_test_paths.h.in"
+  "/root/repo/tpie/CMakeLists.txt"
+  "/root/repo/tpie/config.h.cmake"
+  "/root/repo/tpie/sysinfo.cpp.in"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GenerateExportHeader.cmake"
+  "/usr/share/cmake-3.25/Modules/InstallRequiredSystemLibraries.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/exportheader.cmake.in"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/git-data/HEAD"
+  "CMakeFiles/git-data/grabRef.cmake"
+  "CMakeFiles/git-data/head-ref"
+  "tpie/config.h"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tpie/sysinfo.cpp"
+  "tpie/tpie_export.h"
+  "tpie/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doc/html/madalgo-doxygen.css"
+  "doc/html/printstyle.css"
+  "doc/html/pipelining_memory.png"
+  "doc/html/pipelining_sequence.png"
+  "doc/html/pipelining_sequence_pull.png"
+  "doc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/speed_regression/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/unit/tpie_test_paths.h"
+  "test/unit/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/convex_hull/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/merge_fractions/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/pipelining_datastructures/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/unique/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/pipelining_passive_sorter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/siv_dump/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "tpie/CMakeFiles/tpie.dir/DependInfo.cmake"
+  "doc/CMakeFiles/doccode.dir/DependInfo.cmake"
+  "test/CMakeFiles/test_common.dir/DependInfo.cmake"
+  "test/CMakeFiles/test_ami_stack.dir/DependInfo.cmake"
+  "test/CMakeFiles/test_sort.dir/DependInfo.cmake"
+  "test/CMakeFiles/test_big_scan.dir/DependInfo.cmake"
+  "test/CMakeFiles/test_pipelining.dir/DependInfo.cmake"
+  "test/CMakeFiles/pipelining2.dir/DependInfo.cmake"
+  "test/CMakeFiles/tpiecat.dir/DependInfo.cmake"
+  "test/CMakeFiles/sort.dir/DependInfo.cmake"
+  "test/CMakeFiles/lines.dir/DependInfo.cmake"
+  "test/CMakeFiles/test_parallel_sort_threshold.dir/DependInfo.cmake"
+  "test/CMakeFiles/test_job_overhead.dir/DependInfo.cmake"
+  "test/CMakeFiles/atomic_stats.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/btree_speed_test.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/compressed_speed_test.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/stream_speed_test.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/stream_speed_test_2.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/progress_speed_test.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/sort_speed_test.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/queue_speed_test.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/pq_speed_test.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/array_speed_test.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/file_stream_speed_test.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/pipeline_speed_test.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/pipelining_sort_test.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/serialization_speed.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/numbergen.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/fractile_tpie.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/fractile_serialization.dir/DependInfo.cmake"
+  "test/speed_regression/CMakeFiles/btree_builder.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-allocator.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-ami_stream.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-array.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-block_collection.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-block_collection_cache.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-compressed_stream.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-btree.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-disjoint_set.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-external_priority_queue.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-external_queue.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-external_sort.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-external_stack.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-file_count.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-filestream.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-freespace_collection.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-internal_priority_queue.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-internal_queue.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-internal_stack.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-internal_vector.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-job.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-memory.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-merge_sort.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-packed_array.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-parallel_sort.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-serialization.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-serialization_sort.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-stats.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-stream.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-stream_exception.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-pipelining.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-pipelining_runtime.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-pipelining_serialization.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-maybe.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-close_file.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-node_name.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-snappy.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-tiny.dir/DependInfo.cmake"
+  "test/unit/CMakeFiles/ut-raw_file_accessor.dir/DependInfo.cmake"
+  "apps/convex_hull/CMakeFiles/convex_hull.dir/DependInfo.cmake"
+  "apps/merge_fractions/CMakeFiles/merge_fractions.dir/DependInfo.cmake"
+  "apps/pipelining_datastructures/CMakeFiles/pipelining_datastructures.dir/DependInfo.cmake"
+  "apps/unique/CMakeFiles/unique.dir/DependInfo.cmake"
+  "apps/pipelining_passive_sorter/CMakeFiles/pipelining_passive_sorter.dir/DependInfo.cmake"
+  "apps/siv_dump/CMakeFiles/siv_dump.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/apps
+# Build directory: /root/repo/_debug_build/apps
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("convex_hull")
+subdirs("merge_fractions")
+subdirs("pipelining_datastructures")
+subdirs("unique")
+subdirs("pipelining_passive_sorter")
+subdirs("siv_dump")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/merge_fractions.dir/merge_fractions.cpp.o"
+  "CMakeFiles/merge_fractions.dir/merge_fractions.cpp.o.d"
+  "merge_fractions"
+  "merge_fractions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/merge_fractions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
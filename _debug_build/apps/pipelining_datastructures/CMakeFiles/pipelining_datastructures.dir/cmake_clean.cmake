@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pipelining_datastructures.dir/pipelining_datastructures.cpp.o"
+  "CMakeFiles/pipelining_datastructures.dir/pipelining_datastructures.cpp.o.d"
+  "pipelining_datastructures"
+  "pipelining_datastructures.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pipelining_datastructures.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
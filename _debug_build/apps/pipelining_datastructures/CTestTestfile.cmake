@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/apps/pipelining_datastructures
+# Build directory: /root/repo/_debug_build/apps/pipelining_datastructures
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pipelining_passive_sorter.dir/pipelining_passive_sorter.cpp.o"
+  "CMakeFiles/pipelining_passive_sorter.dir/pipelining_passive_sorter.cpp.o.d"
+  "pipelining_passive_sorter"
+  "pipelining_passive_sorter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pipelining_passive_sorter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/apps/pipelining_passive_sorter
+# Build directory: /root/repo/_debug_build/apps/pipelining_passive_sorter
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/siv_dump.dir/siv_dump.cpp.o"
+  "CMakeFiles/siv_dump.dir/siv_dump.cpp.o.d"
+  "siv_dump"
+  "siv_dump.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/siv_dump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unique.dir/unique.cpp.o"
+  "CMakeFiles/unique.dir/unique.cpp.o.d"
+  "unique"
+  "unique.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unique.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
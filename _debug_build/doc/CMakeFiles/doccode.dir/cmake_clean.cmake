@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/doccode.dir/code/code.cpp.o"
+  "CMakeFiles/doccode.dir/code/code.cpp.o.d"
+  "doccode"
+  "doccode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/doccode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/atomic_stats.dir/test_atomic_stats.cpp.o"
+  "CMakeFiles/atomic_stats.dir/test_atomic_stats.cpp.o.d"
+  "atomic_stats"
+  "atomic_stats.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/atomic_stats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
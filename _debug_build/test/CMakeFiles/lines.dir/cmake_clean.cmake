@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lines.dir/lines.cpp.o"
+  "CMakeFiles/lines.dir/lines.cpp.o.d"
+  "lines"
+  "lines.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lines.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pipelining2.dir/pipelining2.cpp.o"
+  "CMakeFiles/pipelining2.dir/pipelining2.cpp.o.d"
+  "pipelining2"
+  "pipelining2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pipelining2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sort.dir/sort.cpp.o"
+  "CMakeFiles/sort.dir/sort.cpp.o.d"
+  "sort"
+  "sort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_ami_stack.dir/test_ami_stack.cpp.o"
+  "CMakeFiles/test_ami_stack.dir/test_ami_stack.cpp.o.d"
+  "test_ami_stack"
+  "test_ami_stack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ami_stack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_big_scan.dir/test_big_scan.cpp.o"
+  "CMakeFiles/test_big_scan.dir/test_big_scan.cpp.o.d"
+  "test_big_scan"
+  "test_big_scan.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_big_scan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
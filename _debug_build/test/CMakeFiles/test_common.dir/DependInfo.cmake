@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/app_config.cpp" "test/CMakeFiles/test_common.dir/app_config.cpp.o" "gcc" "test/CMakeFiles/test_common.dir/app_config.cpp.o.d"
+  "/root/repo/test/getopts.cpp" "test/CMakeFiles/test_common.dir/getopts.cpp.o" "gcc" "test/CMakeFiles/test_common.dir/getopts.cpp.o.d"
+  "/root/repo/test/parse_args.cpp" "test/CMakeFiles/test_common.dir/parse_args.cpp.o" "gcc" "test/CMakeFiles/test_common.dir/parse_args.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/tpie/CMakeFiles/tpie.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_common.dir/app_config.cpp.o"
+  "CMakeFiles/test_common.dir/app_config.cpp.o.d"
+  "CMakeFiles/test_common.dir/getopts.cpp.o"
+  "CMakeFiles/test_common.dir/getopts.cpp.o.d"
+  "CMakeFiles/test_common.dir/parse_args.cpp.o"
+  "CMakeFiles/test_common.dir/parse_args.cpp.o.d"
+  "libtest_common.a"
+  "libtest_common.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_job_overhead.dir/test_job_overhead.cpp.o"
+  "CMakeFiles/test_job_overhead.dir/test_job_overhead.cpp.o.d"
+  "test_job_overhead"
+  "test_job_overhead.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_job_overhead.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
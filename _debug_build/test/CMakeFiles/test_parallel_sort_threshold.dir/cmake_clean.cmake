@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_parallel_sort_threshold.dir/test_parallel_sort_threshold.cpp.o"
+  "CMakeFiles/test_parallel_sort_threshold.dir/test_parallel_sort_threshold.cpp.o.d"
+  "test_parallel_sort_threshold"
+  "test_parallel_sort_threshold.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_parallel_sort_threshold.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
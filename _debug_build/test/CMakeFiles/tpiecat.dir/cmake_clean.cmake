@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tpiecat.dir/cat.cpp.o"
+  "CMakeFiles/tpiecat.dir/cat.cpp.o.d"
+  "tpiecat"
+  "tpiecat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tpiecat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
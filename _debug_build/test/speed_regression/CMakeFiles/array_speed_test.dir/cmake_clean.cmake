@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/array_speed_test.dir/array.cpp.o"
+  "CMakeFiles/array_speed_test.dir/array.cpp.o.d"
+  "array_speed_test"
+  "array_speed_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/array_speed_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
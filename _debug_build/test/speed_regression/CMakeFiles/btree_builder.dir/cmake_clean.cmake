@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/btree_builder.dir/btree_builder.cpp.o"
+  "CMakeFiles/btree_builder.dir/btree_builder.cpp.o.d"
+  "btree_builder"
+  "btree_builder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/btree_builder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/btree_speed_test.dir/btree.cpp.o"
+  "CMakeFiles/btree_speed_test.dir/btree.cpp.o.d"
+  "btree_speed_test"
+  "btree_speed_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/btree_speed_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compressed_speed_test.dir/compressed.cpp.o"
+  "CMakeFiles/compressed_speed_test.dir/compressed.cpp.o.d"
+  "compressed_speed_test"
+  "compressed_speed_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compressed_speed_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
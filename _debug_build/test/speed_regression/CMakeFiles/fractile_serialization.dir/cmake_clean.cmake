@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fractile_serialization.dir/fractile_serialization.cpp.o"
+  "CMakeFiles/fractile_serialization.dir/fractile_serialization.cpp.o.d"
+  "fractile_serialization"
+  "fractile_serialization.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fractile_serialization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
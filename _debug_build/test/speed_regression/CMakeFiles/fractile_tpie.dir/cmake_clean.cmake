@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fractile_tpie.dir/fractile_tpie.cpp.o"
+  "CMakeFiles/fractile_tpie.dir/fractile_tpie.cpp.o.d"
+  "fractile_tpie"
+  "fractile_tpie.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fractile_tpie.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numbergen.dir/numbergen.cpp.o"
+  "CMakeFiles/numbergen.dir/numbergen.cpp.o.d"
+  "numbergen"
+  "numbergen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numbergen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pipeline_speed_test.dir/pipelining.cpp.o"
+  "CMakeFiles/pipeline_speed_test.dir/pipelining.cpp.o.d"
+  "pipeline_speed_test"
+  "pipeline_speed_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pipeline_speed_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
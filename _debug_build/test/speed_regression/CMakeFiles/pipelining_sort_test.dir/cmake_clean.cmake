@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pipelining_sort_test.dir/pipelining_sort_test.cpp.o"
+  "CMakeFiles/pipelining_sort_test.dir/pipelining_sort_test.cpp.o.d"
+  "pipelining_sort_test"
+  "pipelining_sort_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pipelining_sort_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pq_speed_test.dir/priority_queue.cpp.o"
+  "CMakeFiles/pq_speed_test.dir/priority_queue.cpp.o.d"
+  "pq_speed_test"
+  "pq_speed_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pq_speed_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
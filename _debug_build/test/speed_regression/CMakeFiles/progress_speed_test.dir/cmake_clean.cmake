@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/progress_speed_test.dir/progress.cpp.o"
+  "CMakeFiles/progress_speed_test.dir/progress.cpp.o.d"
+  "progress_speed_test"
+  "progress_speed_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/progress_speed_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
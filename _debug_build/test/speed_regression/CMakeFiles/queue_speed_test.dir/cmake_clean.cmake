@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/queue_speed_test.dir/queue.cpp.o"
+  "CMakeFiles/queue_speed_test.dir/queue.cpp.o.d"
+  "queue_speed_test"
+  "queue_speed_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/queue_speed_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/serialization_speed.dir/serialization.cpp.o"
+  "CMakeFiles/serialization_speed.dir/serialization.cpp.o.d"
+  "serialization_speed"
+  "serialization_speed.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serialization_speed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sort_speed_test.dir/sort.cpp.o"
+  "CMakeFiles/sort_speed_test.dir/sort.cpp.o.d"
+  "sort_speed_test"
+  "sort_speed_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sort_speed_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stream_speed_test.dir/stream.cpp.o"
+  "CMakeFiles/stream_speed_test.dir/stream.cpp.o.d"
+  "stream_speed_test"
+  "stream_speed_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stream_speed_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stream_speed_test_2.dir/stream2.cpp.o"
+  "CMakeFiles/stream_speed_test_2.dir/stream2.cpp.o.d"
+  "stream_speed_test_2"
+  "stream_speed_test_2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stream_speed_test_2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
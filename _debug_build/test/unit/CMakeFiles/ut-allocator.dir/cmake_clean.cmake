@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-allocator.dir/test_allocator.cpp.o"
+  "CMakeFiles/ut-allocator.dir/test_allocator.cpp.o.d"
+  "ut-allocator"
+  "ut-allocator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-allocator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
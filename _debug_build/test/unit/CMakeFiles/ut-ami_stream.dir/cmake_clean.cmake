@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-ami_stream.dir/test_ami_stream.cpp.o"
+  "CMakeFiles/ut-ami_stream.dir/test_ami_stream.cpp.o.d"
+  "ut-ami_stream"
+  "ut-ami_stream.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-ami_stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-array.dir/test_array.cpp.o"
+  "CMakeFiles/ut-array.dir/test_array.cpp.o.d"
+  "ut-array"
+  "ut-array.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-array.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
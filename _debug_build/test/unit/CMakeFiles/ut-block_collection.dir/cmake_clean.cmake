@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-block_collection.dir/test_block_collection.cpp.o"
+  "CMakeFiles/ut-block_collection.dir/test_block_collection.cpp.o.d"
+  "ut-block_collection"
+  "ut-block_collection.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-block_collection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
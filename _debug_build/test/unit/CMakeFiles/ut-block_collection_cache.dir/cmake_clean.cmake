@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-block_collection_cache.dir/test_block_collection_cache.cpp.o"
+  "CMakeFiles/ut-block_collection_cache.dir/test_block_collection_cache.cpp.o.d"
+  "ut-block_collection_cache"
+  "ut-block_collection_cache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-block_collection_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-btree.dir/test_btree.cpp.o"
+  "CMakeFiles/ut-btree.dir/test_btree.cpp.o.d"
+  "ut-btree"
+  "ut-btree.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-btree.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-close_file.dir/test_close_file.cpp.o"
+  "CMakeFiles/ut-close_file.dir/test_close_file.cpp.o.d"
+  "ut-close_file"
+  "ut-close_file.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-close_file.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
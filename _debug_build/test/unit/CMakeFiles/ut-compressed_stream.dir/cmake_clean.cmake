@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-compressed_stream.dir/test_compressed_stream.cpp.o"
+  "CMakeFiles/ut-compressed_stream.dir/test_compressed_stream.cpp.o.d"
+  "ut-compressed_stream"
+  "ut-compressed_stream.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-compressed_stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-disjoint_set.dir/test_disjoint_set.cpp.o"
+  "CMakeFiles/ut-disjoint_set.dir/test_disjoint_set.cpp.o.d"
+  "ut-disjoint_set"
+  "ut-disjoint_set.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-disjoint_set.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-external_priority_queue.dir/test_external_priority_queue.cpp.o"
+  "CMakeFiles/ut-external_priority_queue.dir/test_external_priority_queue.cpp.o.d"
+  "ut-external_priority_queue"
+  "ut-external_priority_queue.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-external_priority_queue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
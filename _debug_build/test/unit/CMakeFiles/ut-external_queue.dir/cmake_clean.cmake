@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-external_queue.dir/test_external_queue.cpp.o"
+  "CMakeFiles/ut-external_queue.dir/test_external_queue.cpp.o.d"
+  "ut-external_queue"
+  "ut-external_queue.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-external_queue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-external_sort.dir/test_external_sort.cpp.o"
+  "CMakeFiles/ut-external_sort.dir/test_external_sort.cpp.o.d"
+  "ut-external_sort"
+  "ut-external_sort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-external_sort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
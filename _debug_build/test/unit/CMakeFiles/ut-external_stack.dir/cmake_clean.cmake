@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-external_stack.dir/test_external_stack.cpp.o"
+  "CMakeFiles/ut-external_stack.dir/test_external_stack.cpp.o.d"
+  "ut-external_stack"
+  "ut-external_stack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-external_stack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-file_count.dir/test_file_count.cpp.o"
+  "CMakeFiles/ut-file_count.dir/test_file_count.cpp.o.d"
+  "ut-file_count"
+  "ut-file_count.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-file_count.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
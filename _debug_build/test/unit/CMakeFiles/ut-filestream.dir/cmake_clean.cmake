@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-filestream.dir/test_filestream.cpp.o"
+  "CMakeFiles/ut-filestream.dir/test_filestream.cpp.o.d"
+  "ut-filestream"
+  "ut-filestream.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-filestream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
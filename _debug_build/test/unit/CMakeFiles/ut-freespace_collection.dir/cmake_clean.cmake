@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-freespace_collection.dir/test_freespace_collection.cpp.o"
+  "CMakeFiles/ut-freespace_collection.dir/test_freespace_collection.cpp.o.d"
+  "ut-freespace_collection"
+  "ut-freespace_collection.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-freespace_collection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-internal_priority_queue.dir/test_internal_priority_queue.cpp.o"
+  "CMakeFiles/ut-internal_priority_queue.dir/test_internal_priority_queue.cpp.o.d"
+  "ut-internal_priority_queue"
+  "ut-internal_priority_queue.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-internal_priority_queue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-internal_stack.dir/test_internal_stack.cpp.o"
+  "CMakeFiles/ut-internal_stack.dir/test_internal_stack.cpp.o.d"
+  "ut-internal_stack"
+  "ut-internal_stack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-internal_stack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
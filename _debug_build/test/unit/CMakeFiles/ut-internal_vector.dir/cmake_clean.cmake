@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-internal_vector.dir/test_internal_vector.cpp.o"
+  "CMakeFiles/ut-internal_vector.dir/test_internal_vector.cpp.o.d"
+  "ut-internal_vector"
+  "ut-internal_vector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-internal_vector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
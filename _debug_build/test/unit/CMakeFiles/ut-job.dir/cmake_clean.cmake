@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-job.dir/test_job.cpp.o"
+  "CMakeFiles/ut-job.dir/test_job.cpp.o.d"
+  "ut-job"
+  "ut-job.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-job.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-maybe.dir/test_maybe.cpp.o"
+  "CMakeFiles/ut-maybe.dir/test_maybe.cpp.o.d"
+  "ut-maybe"
+  "ut-maybe.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-maybe.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
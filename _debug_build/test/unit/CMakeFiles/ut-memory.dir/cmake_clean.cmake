@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-memory.dir/test_memory.cpp.o"
+  "CMakeFiles/ut-memory.dir/test_memory.cpp.o.d"
+  "ut-memory"
+  "ut-memory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
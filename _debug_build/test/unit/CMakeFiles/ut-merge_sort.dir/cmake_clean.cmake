@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-merge_sort.dir/test_merge_sort.cpp.o"
+  "CMakeFiles/ut-merge_sort.dir/test_merge_sort.cpp.o.d"
+  "ut-merge_sort"
+  "ut-merge_sort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-merge_sort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-node_name.dir/test_node_name.cpp.o"
+  "CMakeFiles/ut-node_name.dir/test_node_name.cpp.o.d"
+  "ut-node_name"
+  "ut-node_name.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-node_name.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
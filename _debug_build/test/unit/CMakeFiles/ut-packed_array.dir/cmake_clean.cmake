@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-packed_array.dir/test_packed_array.cpp.o"
+  "CMakeFiles/ut-packed_array.dir/test_packed_array.cpp.o.d"
+  "ut-packed_array"
+  "ut-packed_array.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-packed_array.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
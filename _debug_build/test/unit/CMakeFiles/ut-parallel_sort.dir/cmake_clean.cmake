@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-parallel_sort.dir/test_parallel_sort.cpp.o"
+  "CMakeFiles/ut-parallel_sort.dir/test_parallel_sort.cpp.o.d"
+  "ut-parallel_sort"
+  "ut-parallel_sort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-parallel_sort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
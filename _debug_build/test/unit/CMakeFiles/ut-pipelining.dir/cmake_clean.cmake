@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-pipelining.dir/test_pipelining.cpp.o"
+  "CMakeFiles/ut-pipelining.dir/test_pipelining.cpp.o.d"
+  "ut-pipelining"
+  "ut-pipelining.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-pipelining.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-pipelining_runtime.dir/test_pipelining_runtime.cpp.o"
+  "CMakeFiles/ut-pipelining_runtime.dir/test_pipelining_runtime.cpp.o.d"
+  "ut-pipelining_runtime"
+  "ut-pipelining_runtime.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-pipelining_runtime.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-pipelining_serialization.dir/test_pipelining_serialization.cpp.o"
+  "CMakeFiles/ut-pipelining_serialization.dir/test_pipelining_serialization.cpp.o.d"
+  "ut-pipelining_serialization"
+  "ut-pipelining_serialization.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-pipelining_serialization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
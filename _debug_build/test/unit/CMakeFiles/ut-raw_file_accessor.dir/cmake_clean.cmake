@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-raw_file_accessor.dir/test_raw_file_accessor.cpp.o"
+  "CMakeFiles/ut-raw_file_accessor.dir/test_raw_file_accessor.cpp.o.d"
+  "ut-raw_file_accessor"
+  "ut-raw_file_accessor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-raw_file_accessor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
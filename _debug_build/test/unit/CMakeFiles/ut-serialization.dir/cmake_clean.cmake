@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-serialization.dir/test_serialization.cpp.o"
+  "CMakeFiles/ut-serialization.dir/test_serialization.cpp.o.d"
+  "ut-serialization"
+  "ut-serialization.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-serialization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
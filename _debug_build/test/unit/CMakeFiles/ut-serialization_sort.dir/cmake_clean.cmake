@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-serialization_sort.dir/test_serialization_sort.cpp.o"
+  "CMakeFiles/ut-serialization_sort.dir/test_serialization_sort.cpp.o.d"
+  "ut-serialization_sort"
+  "ut-serialization_sort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-serialization_sort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-snappy.dir/test_snappy.cpp.o"
+  "CMakeFiles/ut-snappy.dir/test_snappy.cpp.o.d"
+  "ut-snappy"
+  "ut-snappy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-snappy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
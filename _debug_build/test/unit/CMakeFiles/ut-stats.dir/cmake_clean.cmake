@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-stats.dir/test_stats.cpp.o"
+  "CMakeFiles/ut-stats.dir/test_stats.cpp.o.d"
+  "ut-stats"
+  "ut-stats.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-stats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
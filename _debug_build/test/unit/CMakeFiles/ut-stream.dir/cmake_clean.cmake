@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-stream.dir/test_stream.cpp.o"
+  "CMakeFiles/ut-stream.dir/test_stream.cpp.o.d"
+  "ut-stream"
+  "ut-stream.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
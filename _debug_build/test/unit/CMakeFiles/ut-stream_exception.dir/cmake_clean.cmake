@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-stream_exception.dir/test_stream_exception.cpp.o"
+  "CMakeFiles/ut-stream_exception.dir/test_stream_exception.cpp.o.d"
+  "ut-stream_exception"
+  "ut-stream_exception.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-stream_exception.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
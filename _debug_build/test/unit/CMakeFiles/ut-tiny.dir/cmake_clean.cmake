@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ut-tiny.dir/test_tiny.cpp.o"
+  "CMakeFiles/ut-tiny.dir/test_tiny.cpp.o.d"
+  "ut-tiny"
+  "ut-tiny.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ut-tiny.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
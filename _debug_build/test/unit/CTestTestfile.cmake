@@ -0,0 +1,762 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/unit
+# Build directory: /root/repo/_debug_build/test/unit
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(allocator_deque "ut-allocator" "deque")
+set_tests_properties(allocator_deque PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;29;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(allocator_list "ut-allocator" "list")
+set_tests_properties(allocator_list PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;29;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(ami_stream_basic "ut-ami_stream" "basic")
+set_tests_properties(ami_stream_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;30;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(ami_stream_truncate "ut-ami_stream" "truncate")
+set_tests_properties(ami_stream_truncate PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;30;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(array_basic "ut-array" "basic")
+set_tests_properties(array_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;31;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(array_iterators "ut-array" "iterators")
+set_tests_properties(array_iterators PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;31;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(array_unique_ptr "ut-array" "unique_ptr")
+set_tests_properties(array_unique_ptr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;31;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(array_memory "ut-array" "memory")
+set_tests_properties(array_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;31;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(array_bit_basic "ut-array" "bit_basic")
+set_tests_properties(array_bit_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;31;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(array_bit_iterators "ut-array" "bit_iterators")
+set_tests_properties(array_bit_iterators PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;31;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(array_bit_memory "ut-array" "bit_memory")
+set_tests_properties(array_bit_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;31;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(array_copyempty "ut-array" "copyempty")
+set_tests_properties(array_copyempty PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;31;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(array_arrayarray "ut-array" "arrayarray")
+set_tests_properties(array_arrayarray PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;31;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(array_frontback "ut-array" "frontback")
+set_tests_properties(array_frontback PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;31;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(array_swap "ut-array" "swap")
+set_tests_properties(array_swap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;31;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(array_allocator "ut-array" "allocator")
+set_tests_properties(array_allocator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;31;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(array_copy "ut-array" "copy")
+set_tests_properties(array_copy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;31;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(array_from_view "ut-array" "from_view")
+set_tests_properties(array_from_view PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;31;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(array_assign "ut-array" "assign")
+set_tests_properties(array_assign PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;31;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(block_collection_basic "ut-block_collection" "basic")
+set_tests_properties(block_collection_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;48;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(block_collection_erase "ut-block_collection" "erase")
+set_tests_properties(block_collection_erase PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;48;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(block_collection_overwrite "ut-block_collection" "overwrite")
+set_tests_properties(block_collection_overwrite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;48;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(block_collection_cache_basic "ut-block_collection_cache" "basic")
+set_tests_properties(block_collection_cache_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;49;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(block_collection_cache_erase "ut-block_collection_cache" "erase")
+set_tests_properties(block_collection_cache_erase PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;49;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(block_collection_cache_overwrite "ut-block_collection_cache" "overwrite")
+set_tests_properties(block_collection_cache_overwrite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;49;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_basic "ut-compressed_stream" "basic")
+set_tests_properties(compressed_stream_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_seek "ut-compressed_stream" "seek")
+set_tests_properties(compressed_stream_seek PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_seek_2 "ut-compressed_stream" "seek_2")
+set_tests_properties(compressed_stream_seek_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_reopen_1 "ut-compressed_stream" "reopen_1")
+set_tests_properties(compressed_stream_reopen_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_reopen_2 "ut-compressed_stream" "reopen_2")
+set_tests_properties(compressed_stream_reopen_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_read_seek "ut-compressed_stream" "read_seek")
+set_tests_properties(compressed_stream_read_seek PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_truncate "ut-compressed_stream" "truncate")
+set_tests_properties(compressed_stream_truncate PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_truncate_2 "ut-compressed_stream" "truncate_2")
+set_tests_properties(compressed_stream_truncate_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_0 "ut-compressed_stream" "position_0")
+set_tests_properties(compressed_stream_position_0 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_1 "ut-compressed_stream" "position_1")
+set_tests_properties(compressed_stream_position_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_2 "ut-compressed_stream" "position_2")
+set_tests_properties(compressed_stream_position_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_3 "ut-compressed_stream" "position_3")
+set_tests_properties(compressed_stream_position_3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_4 "ut-compressed_stream" "position_4")
+set_tests_properties(compressed_stream_position_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_5 "ut-compressed_stream" "position_5")
+set_tests_properties(compressed_stream_position_5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_6 "ut-compressed_stream" "position_6")
+set_tests_properties(compressed_stream_position_6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_7 "ut-compressed_stream" "position_7")
+set_tests_properties(compressed_stream_position_7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_8 "ut-compressed_stream" "position_8")
+set_tests_properties(compressed_stream_position_8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_9 "ut-compressed_stream" "position_9")
+set_tests_properties(compressed_stream_position_9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_seek "ut-compressed_stream" "position_seek")
+set_tests_properties(compressed_stream_position_seek PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_uncompressed "ut-compressed_stream" "uncompressed")
+set_tests_properties(compressed_stream_uncompressed PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_uncompressed_new "ut-compressed_stream" "uncompressed_new")
+set_tests_properties(compressed_stream_uncompressed_new PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_backwards "ut-compressed_stream" "backwards")
+set_tests_properties(compressed_stream_backwards PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_read_back_seek "ut-compressed_stream" "read_back_seek")
+set_tests_properties(compressed_stream_read_back_seek PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_read_back_seek_2 "ut-compressed_stream" "read_back_seek_2")
+set_tests_properties(compressed_stream_read_back_seek_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_read_back_throw "ut-compressed_stream" "read_back_throw")
+set_tests_properties(compressed_stream_read_back_throw PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_prefetch "ut-compressed_stream" "prefetch")
+set_tests_properties(compressed_stream_prefetch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_basic_u "ut-compressed_stream" "basic_u")
+set_tests_properties(compressed_stream_basic_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_seek_u "ut-compressed_stream" "seek_u")
+set_tests_properties(compressed_stream_seek_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_seek_2_u "ut-compressed_stream" "seek_2_u")
+set_tests_properties(compressed_stream_seek_2_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_reopen_1_u "ut-compressed_stream" "reopen_1_u")
+set_tests_properties(compressed_stream_reopen_1_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_reopen_2_u "ut-compressed_stream" "reopen_2_u")
+set_tests_properties(compressed_stream_reopen_2_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_read_seek_u "ut-compressed_stream" "read_seek_u")
+set_tests_properties(compressed_stream_read_seek_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_truncate_u "ut-compressed_stream" "truncate_u")
+set_tests_properties(compressed_stream_truncate_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_truncate_2_u "ut-compressed_stream" "truncate_2_u")
+set_tests_properties(compressed_stream_truncate_2_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_0_u "ut-compressed_stream" "position_0_u")
+set_tests_properties(compressed_stream_position_0_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_1_u "ut-compressed_stream" "position_1_u")
+set_tests_properties(compressed_stream_position_1_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_2_u "ut-compressed_stream" "position_2_u")
+set_tests_properties(compressed_stream_position_2_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_3_u "ut-compressed_stream" "position_3_u")
+set_tests_properties(compressed_stream_position_3_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_4_u "ut-compressed_stream" "position_4_u")
+set_tests_properties(compressed_stream_position_4_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_5_u "ut-compressed_stream" "position_5_u")
+set_tests_properties(compressed_stream_position_5_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_6_u "ut-compressed_stream" "position_6_u")
+set_tests_properties(compressed_stream_position_6_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_7_u "ut-compressed_stream" "position_7_u")
+set_tests_properties(compressed_stream_position_7_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_8_u "ut-compressed_stream" "position_8_u")
+set_tests_properties(compressed_stream_position_8_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_9_u "ut-compressed_stream" "position_9_u")
+set_tests_properties(compressed_stream_position_9_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_position_seek_u "ut-compressed_stream" "position_seek_u")
+set_tests_properties(compressed_stream_position_seek_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_uncompressed_u "ut-compressed_stream" "uncompressed_u")
+set_tests_properties(compressed_stream_uncompressed_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_uncompressed_new_u "ut-compressed_stream" "uncompressed_new_u")
+set_tests_properties(compressed_stream_uncompressed_new_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_backwards_u "ut-compressed_stream" "backwards_u")
+set_tests_properties(compressed_stream_backwards_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_read_back_seek_u "ut-compressed_stream" "read_back_seek_u")
+set_tests_properties(compressed_stream_read_back_seek_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_read_back_seek_2_u "ut-compressed_stream" "read_back_seek_2_u")
+set_tests_properties(compressed_stream_read_back_seek_2_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_read_back_throw_u "ut-compressed_stream" "read_back_throw_u")
+set_tests_properties(compressed_stream_read_back_throw_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_prefetch_u "ut-compressed_stream" "prefetch_u")
+set_tests_properties(compressed_stream_prefetch_u PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_backwards_fs "ut-compressed_stream" "backwards_fs")
+set_tests_properties(compressed_stream_backwards_fs PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_odd_block_size "ut-compressed_stream" "odd_block_size")
+set_tests_properties(compressed_stream_odd_block_size PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_write_only "ut-compressed_stream" "write_only")
+set_tests_properties(compressed_stream_write_only PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_write_peek "ut-compressed_stream" "write_peek")
+set_tests_properties(compressed_stream_write_peek PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(compressed_stream_lockstep_reverse "ut-compressed_stream" "lockstep_reverse")
+set_tests_properties(compressed_stream_lockstep_reverse PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;50;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_internal_augment "ut-btree" "internal_augment")
+set_tests_properties(btree_internal_augment PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_internal_basic "ut-btree" "internal_basic")
+set_tests_properties(btree_internal_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_internal_build "ut-btree" "internal_build")
+set_tests_properties(btree_internal_build PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_internal_static "ut-btree" "internal_static")
+set_tests_properties(btree_internal_static PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_internal_unordered "ut-btree" "internal_unordered")
+set_tests_properties(btree_internal_unordered PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_internal_bound "ut-btree" "internal_bound")
+set_tests_properties(btree_internal_bound PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_internal_iterator "ut-btree" "internal_iterator")
+set_tests_properties(btree_internal_iterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_internal_key_and_compare "ut-btree" "internal_key_and_compare")
+set_tests_properties(btree_internal_key_and_compare PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_external_augment "ut-btree" "external_augment")
+set_tests_properties(btree_external_augment PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_external_basic "ut-btree" "external_basic")
+set_tests_properties(btree_external_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_external_bound "ut-btree" "external_bound")
+set_tests_properties(btree_external_bound PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_external_build "ut-btree" "external_build")
+set_tests_properties(btree_external_build PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_external_iterator "ut-btree" "external_iterator")
+set_tests_properties(btree_external_iterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_external_key_and_compare "ut-btree" "external_key_and_compare")
+set_tests_properties(btree_external_key_and_compare PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_external_reopen "ut-btree" "external_reopen")
+set_tests_properties(btree_external_reopen PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_external_sort_into "ut-btree" "external_sort_into")
+set_tests_properties(btree_external_sort_into PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_external_static_reopen "ut-btree" "external_static_reopen")
+set_tests_properties(btree_external_static_reopen PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_external_static_iterator "ut-btree" "external_static_iterator")
+set_tests_properties(btree_external_static_iterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_serialized_build "ut-btree" "serialized_build")
+set_tests_properties(btree_serialized_build PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_serialized_reopen "ut-btree" "serialized_reopen")
+set_tests_properties(btree_serialized_reopen PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_serialized_iterator "ut-btree" "serialized_iterator")
+set_tests_properties(btree_serialized_iterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_serialized_lz4_build "ut-btree" "serialized_lz4_build")
+set_tests_properties(btree_serialized_lz4_build PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_serialized_lz4_reopen "ut-btree" "serialized_lz4_reopen")
+set_tests_properties(btree_serialized_lz4_reopen PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_serialized_read_old_format "ut-btree" "serialized_read_old_format")
+set_tests_properties(btree_serialized_read_old_format PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_serialized_snappy_build "ut-btree" "serialized_snappy_build")
+set_tests_properties(btree_serialized_snappy_build PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_serialized_sort_into "ut-btree" "serialized_sort_into")
+set_tests_properties(btree_serialized_sort_into PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_serialized_string_sort_into "ut-btree" "serialized_string_sort_into")
+set_tests_properties(btree_serialized_string_sort_into PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_serialized_snappy_reopen "ut-btree" "serialized_snappy_reopen")
+set_tests_properties(btree_serialized_snappy_reopen PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_serialized_zstd_build "ut-btree" "serialized_zstd_build")
+set_tests_properties(btree_serialized_zstd_build PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(btree_serialized_zstd_reopen "ut-btree" "serialized_zstd_reopen")
+set_tests_properties(btree_serialized_zstd_reopen PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;74;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(disjoint_set_basic "ut-disjoint_set" "basic")
+set_tests_properties(disjoint_set_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;109;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(disjoint_set_memory "ut-disjoint_set" "memory")
+set_tests_properties(disjoint_set_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;109;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_priority_queue_basic "ut-external_priority_queue" "basic")
+set_tests_properties(external_priority_queue_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;110;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_priority_queue_batch "ut-external_priority_queue" "batch")
+set_tests_properties(external_priority_queue_batch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;110;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_priority_queue_batch_internal "ut-external_priority_queue" "batch_internal")
+set_tests_properties(external_priority_queue_batch_internal PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;110;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_priority_queue_parameters "ut-external_priority_queue" "parameters")
+set_tests_properties(external_priority_queue_parameters PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;110;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_priority_queue_remove_group_buffer "ut-external_priority_queue" "remove_group_buffer")
+set_tests_properties(external_priority_queue_remove_group_buffer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;110;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_queue_basic "ut-external_queue" "basic")
+set_tests_properties(external_queue_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;111;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_queue_empty_size "ut-external_queue" "empty_size")
+set_tests_properties(external_queue_empty_size PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;111;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_queue_sized "ut-external_queue" "sized")
+set_tests_properties(external_queue_sized PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;111;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_queue_large "ut-external_queue" "large")
+set_tests_properties(external_queue_large PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;111;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_sort_amismall "ut-external_sort" "amismall")
+set_tests_properties(external_sort_amismall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;112;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_sort_out_of_place "ut-external_sort" "out_of_place")
+set_tests_properties(external_sort_out_of_place PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;112;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_sort_small "ut-external_sort" "small")
+set_tests_properties(external_sort_small PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;112;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_sort_tiny "ut-external_sort" "tiny")
+set_tests_properties(external_sort_tiny PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;112;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_stack_new "ut-external_stack" "new")
+set_tests_properties(external_stack_new PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;113;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_stack_named-new "ut-external_stack" "named-new")
+set_tests_properties(external_stack_named-new PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;113;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_stack_ami "ut-external_stack" "ami")
+set_tests_properties(external_stack_ami PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;113;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_stack_named-ami "ut-external_stack" "named-ami")
+set_tests_properties(external_stack_named-ami PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;113;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(external_stack_io "ut-external_stack" "io")
+set_tests_properties(external_stack_io PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;113;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(file_count_basic "ut-file_count" "basic")
+set_tests_properties(file_count_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;114;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(filestream_memory "ut-filestream" "memory")
+set_tests_properties(filestream_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;115;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(freespace_collection_alloc "ut-freespace_collection" "alloc")
+set_tests_properties(freespace_collection_alloc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;116;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(freespace_collection_size "ut-freespace_collection" "size")
+set_tests_properties(freespace_collection_size PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;116;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(internal_priority_queue_basic "ut-internal_priority_queue" "basic")
+set_tests_properties(internal_priority_queue_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;117;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(internal_priority_queue_memory "ut-internal_priority_queue" "memory")
+set_tests_properties(internal_priority_queue_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;117;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(internal_queue_basic "ut-internal_queue" "basic")
+set_tests_properties(internal_queue_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;118;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(internal_queue_memory "ut-internal_queue" "memory")
+set_tests_properties(internal_queue_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;118;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(internal_stack_basic "ut-internal_stack" "basic")
+set_tests_properties(internal_stack_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;119;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(internal_stack_memory "ut-internal_stack" "memory")
+set_tests_properties(internal_stack_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;119;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(internal_vector_basic "ut-internal_vector" "basic")
+set_tests_properties(internal_vector_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;120;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(internal_vector_memory "ut-internal_vector" "memory")
+set_tests_properties(internal_vector_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;120;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(job_repeat "ut-job" "repeat")
+set_tests_properties(job_repeat PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;121;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(memory_basic "ut-memory" "basic")
+set_tests_properties(memory_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;122;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_empty_input "ut-merge_sort" "empty_input")
+set_tests_properties(merge_sort_empty_input PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_internal_report "ut-merge_sort" "internal_report")
+set_tests_properties(merge_sort_internal_report PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_internal_report_after_resize "ut-merge_sort" "internal_report_after_resize")
+set_tests_properties(merge_sort_internal_report_after_resize PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_one_run_external_report "ut-merge_sort" "one_run_external_report")
+set_tests_properties(merge_sort_one_run_external_report PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_external_report "ut-merge_sort" "external_report")
+set_tests_properties(merge_sort_external_report PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_small_final_fanout "ut-merge_sort" "small_final_fanout")
+set_tests_properties(merge_sort_small_final_fanout PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_evacuate_before_merge "ut-merge_sort" "evacuate_before_merge")
+set_tests_properties(merge_sort_evacuate_before_merge PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_evacuate_before_report "ut-merge_sort" "evacuate_before_report")
+set_tests_properties(merge_sort_evacuate_before_report PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_sort_upper_bound "ut-merge_sort" "sort_upper_bound")
+set_tests_properties(merge_sort_sort_upper_bound PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_sort_faulty_upper_bound "ut-merge_sort" "sort_faulty_upper_bound")
+set_tests_properties(merge_sort_sort_faulty_upper_bound PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_temp_file_usage "ut-merge_sort" "temp_file_usage")
+set_tests_properties(merge_sort_temp_file_usage PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_tall_tree "ut-merge_sort" "tall_tree")
+set_tests_properties(merge_sort_tall_tree PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_replacement_selection "ut-merge_sort" "replacement_selection")
+set_tests_properties(merge_sort_replacement_selection PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_replacement_selection_run_count "ut-merge_sort" "replacement_selection_run_count")
+set_tests_properties(merge_sort_replacement_selection_run_count PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_replacement_selection_presorted "ut-merge_sort" "replacement_selection_presorted")
+set_tests_properties(merge_sort_replacement_selection_presorted PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_replacement_selection_descending "ut-merge_sort" "replacement_selection_descending")
+set_tests_properties(merge_sort_replacement_selection_descending PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_presorted "ut-merge_sort" "presorted")
+set_tests_properties(merge_sort_presorted PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_sorted_segments "ut-merge_sort" "sorted_segments")
+set_tests_properties(merge_sort_sorted_segments PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_unaligned_sorted_segments "ut-merge_sort" "unaligned_sorted_segments")
+set_tests_properties(merge_sort_unaligned_sorted_segments PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_key_prefix_internal "ut-merge_sort" "key_prefix_internal")
+set_tests_properties(merge_sort_key_prefix_internal PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_key_prefix "ut-merge_sort" "key_prefix")
+set_tests_properties(merge_sort_key_prefix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_combine "ut-merge_sort" "combine")
+set_tests_properties(merge_sort_combine PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_combine_internal "ut-merge_sort" "combine_internal")
+set_tests_properties(merge_sort_combine_internal PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_limit "ut-merge_sort" "limit")
+set_tests_properties(merge_sort_limit PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_cost_model "ut-merge_sort" "cost_model")
+set_tests_properties(merge_sort_cost_model PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_cost_model_sort "ut-merge_sort" "cost_model_sort")
+set_tests_properties(merge_sort_cost_model_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_merge_prefetch "ut-merge_sort" "merge_prefetch")
+set_tests_properties(merge_sort_merge_prefetch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_stable "ut-merge_sort" "stable")
+set_tests_properties(merge_sort_stable PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(merge_sort_stable_key_prefix "ut-merge_sort" "stable_key_prefix")
+set_tests_properties(merge_sort_stable_key_prefix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;123;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(packed_array_basic1 "ut-packed_array" "basic1")
+set_tests_properties(packed_array_basic1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;154;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(packed_array_basic2 "ut-packed_array" "basic2")
+set_tests_properties(packed_array_basic2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;154;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(packed_array_basic4 "ut-packed_array" "basic4")
+set_tests_properties(packed_array_basic4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;154;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(parallel_sort_basic1 "ut-parallel_sort" "basic1")
+set_tests_properties(parallel_sort_basic1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;155;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(parallel_sort_basic2 "ut-parallel_sort" "basic2")
+set_tests_properties(parallel_sort_basic2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;155;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(parallel_sort_general "ut-parallel_sort" "general")
+set_tests_properties(parallel_sort_general PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;155;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(parallel_sort_equal_elements "ut-parallel_sort" "equal_elements")
+set_tests_properties(parallel_sort_equal_elements PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;155;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(parallel_sort_bad_case "ut-parallel_sort" "bad_case")
+set_tests_properties(parallel_sort_bad_case PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;155;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(parallel_sort_sample_sort "ut-parallel_sort" "sample_sort")
+set_tests_properties(parallel_sort_sample_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;155;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_serialization2 "ut-serialization" "serialization2")
+set_tests_properties(serialization_serialization2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;156;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_stream "ut-serialization" "stream")
+set_tests_properties(serialization_stream PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;156;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_stream_dtor "ut-serialization" "stream_dtor")
+set_tests_properties(serialization_stream_dtor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;156;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_stream_reopen "ut-serialization" "stream_reopen")
+set_tests_properties(serialization_stream_reopen PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;156;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_stream_reverse "ut-serialization" "stream_reverse")
+set_tests_properties(serialization_stream_reverse PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;156;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_stream_temp "ut-serialization" "stream_temp")
+set_tests_properties(serialization_stream_temp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;156;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_empty_input "ut-serialization_sort" "empty_input")
+set_tests_properties(serialization_sort_empty_input PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_internal_report "ut-serialization_sort" "internal_report")
+set_tests_properties(serialization_sort_internal_report PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_internal_report_after_resize "ut-serialization_sort" "internal_report_after_resize")
+set_tests_properties(serialization_sort_internal_report_after_resize PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_one_run_external_report "ut-serialization_sort" "one_run_external_report")
+set_tests_properties(serialization_sort_one_run_external_report PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_external_report "ut-serialization_sort" "external_report")
+set_tests_properties(serialization_sort_external_report PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_small_final_fanout "ut-serialization_sort" "small_final_fanout")
+set_tests_properties(serialization_sort_small_final_fanout PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_evacuate_before_merge "ut-serialization_sort" "evacuate_before_merge")
+set_tests_properties(serialization_sort_evacuate_before_merge PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_evacuate_before_report "ut-serialization_sort" "evacuate_before_report")
+set_tests_properties(serialization_sort_evacuate_before_report PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_replacement_selection "ut-serialization_sort" "replacement_selection")
+set_tests_properties(serialization_sort_replacement_selection PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_replacement_selection_run_count "ut-serialization_sort" "replacement_selection_run_count")
+set_tests_properties(serialization_sort_replacement_selection_run_count PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_file_limit "ut-serialization_sort" "file_limit")
+set_tests_properties(serialization_sort_file_limit PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_string_sort_internal "ut-serialization_sort" "string_sort_internal")
+set_tests_properties(serialization_sort_string_sort_internal PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_string_sort "ut-serialization_sort" "string_sort")
+set_tests_properties(serialization_sort_string_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_string_sort_concurrent_merge "ut-serialization_sort" "string_sort_concurrent_merge")
+set_tests_properties(serialization_sort_string_sort_concurrent_merge PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_concurrent_merge "ut-serialization_sort" "concurrent_merge")
+set_tests_properties(serialization_sort_concurrent_merge PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_string_sort_parallel_run_formation "ut-serialization_sort" "string_sort_parallel_run_formation")
+set_tests_properties(serialization_sort_string_sort_parallel_run_formation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(serialization_sort_parallel_run_formation "ut-serialization_sort" "parallel_run_formation")
+set_tests_properties(serialization_sort_parallel_run_formation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;157;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stats_simple "ut-stats" "simple")
+set_tests_properties(stats_simple PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;176;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_basic "ut-stream" "basic")
+set_tests_properties(stream_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_array "ut-stream" "array")
+set_tests_properties(stream_array PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_array_compressed "ut-stream" "array_compressed")
+set_tests_properties(stream_array_compressed PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_odd "ut-stream" "odd")
+set_tests_properties(stream_odd PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_odd_compressed "ut-stream" "odd_compressed")
+set_tests_properties(stream_odd_compressed PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_reopen "ut-stream" "reopen")
+set_tests_properties(stream_reopen PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_truncate "ut-stream" "truncate")
+set_tests_properties(stream_truncate PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_extend "ut-stream" "extend")
+set_tests_properties(stream_extend PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_backwards "ut-stream" "backwards")
+set_tests_properties(stream_backwards PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_array_file "ut-stream" "array_file")
+set_tests_properties(stream_array_file PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_odd_file "ut-stream" "odd_file")
+set_tests_properties(stream_odd_file PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_truncate_file "ut-stream" "truncate_file")
+set_tests_properties(stream_truncate_file PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_extend_file "ut-stream" "extend_file")
+set_tests_properties(stream_extend_file PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_backwards_file "ut-stream" "backwards_file")
+set_tests_properties(stream_backwards_file PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_user_data "ut-stream" "user_data")
+set_tests_properties(stream_user_data PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_user_data_file "ut-stream" "user_data_file")
+set_tests_properties(stream_user_data_file PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_peek_skip_1 "ut-stream" "peek_skip_1")
+set_tests_properties(stream_peek_skip_1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_peek_skip_2 "ut-stream" "peek_skip_2")
+set_tests_properties(stream_peek_skip_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_backwards_compressed "ut-stream" "backwards_compressed")
+set_tests_properties(stream_backwards_compressed PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_extend_compressed "ut-stream" "extend_compressed")
+set_tests_properties(stream_extend_compressed PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_truncate_compressed "ut-stream" "truncate_compressed")
+set_tests_properties(stream_truncate_compressed PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_user_data_compressed "ut-stream" "user_data_compressed")
+set_tests_properties(stream_user_data_compressed PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;177;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(stream_exception_basic "ut-stream_exception" "basic")
+set_tests_properties(stream_exception_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;201;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_vector "ut-pipelining" "vector")
+set_tests_properties(pipelining_vector PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_filestream "ut-pipelining" "filestream")
+set_tests_properties(pipelining_filestream PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_fspull "ut-pipelining" "fspull")
+set_tests_properties(pipelining_fspull PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_merge "ut-pipelining" "merge")
+set_tests_properties(pipelining_merge PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_reverse "ut-pipelining" "reverse")
+set_tests_properties(pipelining_reverse PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_internal_reverse "ut-pipelining" "internal_reverse")
+set_tests_properties(pipelining_internal_reverse PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_passive_reverse "ut-pipelining" "passive_reverse")
+set_tests_properties(pipelining_passive_reverse PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_internal_passive_reverse "ut-pipelining" "internal_passive_reverse")
+set_tests_properties(pipelining_internal_passive_reverse PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_sort "ut-pipelining" "sort")
+set_tests_properties(pipelining_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_sorttrivial "ut-pipelining" "sorttrivial")
+set_tests_properties(pipelining_sorttrivial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_combining_sort "ut-pipelining" "combining_sort")
+set_tests_properties(pipelining_combining_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_partial_sort "ut-pipelining" "partial_sort")
+set_tests_properties(pipelining_partial_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_partial_sort_external "ut-pipelining" "partial_sort_external")
+set_tests_properties(pipelining_partial_sort_external PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_stable_sort "ut-pipelining" "stable_sort")
+set_tests_properties(pipelining_stable_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_distribution_sort "ut-pipelining" "distribution_sort")
+set_tests_properties(pipelining_distribution_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_distribution_sort_external "ut-pipelining" "distribution_sort_external")
+set_tests_properties(pipelining_distribution_sort_external PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_distribution_sort_skewed "ut-pipelining" "distribution_sort_skewed")
+set_tests_properties(pipelining_distribution_sort_skewed PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_operators "ut-pipelining" "operators")
+set_tests_properties(pipelining_operators PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_uniq "ut-pipelining" "uniq")
+set_tests_properties(pipelining_uniq PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_memory "ut-pipelining" "memory")
+set_tests_properties(pipelining_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_fork "ut-pipelining" "fork")
+set_tests_properties(pipelining_fork PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_merger_memory "ut-pipelining" "merger_memory")
+set_tests_properties(pipelining_merger_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_bound_fetch_forward "ut-pipelining" "bound_fetch_forward")
+set_tests_properties(pipelining_bound_fetch_forward PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_fetch_forward "ut-pipelining" "fetch_forward")
+set_tests_properties(pipelining_fetch_forward PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_forward_multiple_pipelines "ut-pipelining" "forward_multiple_pipelines")
+set_tests_properties(pipelining_forward_multiple_pipelines PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_forward_unique_ptr "ut-pipelining" "forward_unique_ptr")
+set_tests_properties(pipelining_forward_unique_ptr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_pipe_base_forward "ut-pipelining" "pipe_base_forward")
+set_tests_properties(pipelining_pipe_base_forward PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_virtual "ut-pipelining" "virtual")
+set_tests_properties(pipelining_virtual PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_virtual_cref_item_type "ut-pipelining" "virtual_cref_item_type")
+set_tests_properties(pipelining_virtual_cref_item_type PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_virtual_fork "ut-pipelining" "virtual_fork")
+set_tests_properties(pipelining_virtual_fork PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_prepare "ut-pipelining" "prepare")
+set_tests_properties(pipelining_prepare PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_end_time "ut-pipelining" "end_time")
+set_tests_properties(pipelining_end_time PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_pull_iterator "ut-pipelining" "pull_iterator")
+set_tests_properties(pipelining_pull_iterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_push_iterator "ut-pipelining" "push_iterator")
+set_tests_properties(pipelining_push_iterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_parallel "ut-pipelining" "parallel")
+set_tests_properties(pipelining_parallel PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_parallel_ordered "ut-pipelining" "parallel_ordered")
+set_tests_properties(pipelining_parallel_ordered PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_parallel_multiple "ut-pipelining" "parallel_multiple")
+set_tests_properties(pipelining_parallel_multiple PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_parallel_own_buffer "ut-pipelining" "parallel_own_buffer")
+set_tests_properties(pipelining_parallel_own_buffer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_parallel_push_in_end "ut-pipelining" "parallel_push_in_end")
+set_tests_properties(pipelining_parallel_push_in_end PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_node_map "ut-pipelining" "node_map")
+set_tests_properties(pipelining_node_map PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_join "ut-pipelining" "join")
+set_tests_properties(pipelining_join PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_split "ut-pipelining" "split")
+set_tests_properties(pipelining_split PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_copy_ctor "ut-pipelining" "copy_ctor")
+set_tests_properties(pipelining_copy_ctor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_datastructures "ut-pipelining" "datastructures")
+set_tests_properties(pipelining_datastructures PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_subpipeline "ut-pipelining" "subpipeline")
+set_tests_properties(pipelining_subpipeline PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_file_limit_sort "ut-pipelining" "file_limit_sort")
+set_tests_properties(pipelining_file_limit_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_passive_virtual_management "ut-pipelining" "passive_virtual_management")
+set_tests_properties(pipelining_passive_virtual_management PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_join_split_dealloc "ut-pipelining" "join_split_dealloc")
+set_tests_properties(pipelining_join_split_dealloc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_nodeset_dealloc "ut-pipelining" "nodeset_dealloc")
+set_tests_properties(pipelining_nodeset_dealloc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_pipeline_dealloc "ut-pipelining" "pipeline_dealloc")
+set_tests_properties(pipelining_pipeline_dealloc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_parallel_exception "ut-pipelining" "parallel_exception")
+set_tests_properties(pipelining_parallel_exception PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_parallel_exception_2 "ut-pipelining" "parallel_exception_2")
+set_tests_properties(pipelining_parallel_exception_2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_exception "ut-pipelining" "exception")
+set_tests_properties(pipelining_exception PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_subpipeline_exception "ut-pipelining" "subpipeline_exception")
+set_tests_properties(pipelining_subpipeline_exception PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_subpipeline_exception2 "ut-pipelining" "subpipeline_exception2")
+set_tests_properties(pipelining_subpipeline_exception2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_pull "ut-pipelining" "pull")
+set_tests_properties(pipelining_pull PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_virtual_pull "ut-pipelining" "virtual_pull")
+set_tests_properties(pipelining_virtual_pull PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_devirtualize "ut-pipelining" "devirtualize")
+set_tests_properties(pipelining_devirtualize PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_devirtualize_pull "ut-pipelining" "devirtualize_pull")
+set_tests_properties(pipelining_devirtualize_pull PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;202;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_runtime_evacuate "ut-pipelining_runtime" "evacuate")
+set_tests_properties(pipelining_runtime_evacuate PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;264;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_runtime_get_phase_graph "ut-pipelining_runtime" "get_phase_graph")
+set_tests_properties(pipelining_runtime_get_phase_graph PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;264;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_runtime_optimal_satisfiable_ordering "ut-pipelining_runtime" "optimal_satisfiable_ordering")
+set_tests_properties(pipelining_runtime_optimal_satisfiable_ordering PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;264;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_runtime_evacuate_phase_graph "ut-pipelining_runtime" "evacuate_phase_graph")
+set_tests_properties(pipelining_runtime_evacuate_phase_graph PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;264;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_serialization_basic "ut-pipelining_serialization" "basic")
+set_tests_properties(pipelining_serialization_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;265;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_serialization_reverse "ut-pipelining_serialization" "reverse")
+set_tests_properties(pipelining_serialization_reverse PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;265;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(pipelining_serialization_sort "ut-pipelining_serialization" "sort")
+set_tests_properties(pipelining_serialization_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;265;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(maybe_basic "ut-maybe" "basic")
+set_tests_properties(maybe_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;266;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(maybe_unique_ptr "ut-maybe" "unique_ptr")
+set_tests_properties(maybe_unique_ptr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;266;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(close_file_internal "ut-close_file" "internal")
+set_tests_properties(close_file_internal PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;267;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(close_file_serialization_writer_close "ut-close_file" "serialization_writer_close")
+set_tests_properties(close_file_serialization_writer_close PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;267;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(close_file_serialization_writer_dtor "ut-close_file" "serialization_writer_dtor")
+set_tests_properties(close_file_serialization_writer_dtor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;267;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(close_file_serialization_reader_dtor "ut-close_file" "serialization_reader_dtor")
+set_tests_properties(close_file_serialization_reader_dtor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;267;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(close_file_file_limit_enforcement "ut-close_file" "file_limit_enforcement")
+set_tests_properties(close_file_file_limit_enforcement PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;267;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(node_name_gcc "ut-node_name" "gcc")
+set_tests_properties(node_name_gcc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;274;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(node_name_msvc "ut-node_name" "msvc")
+set_tests_properties(node_name_msvc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;274;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(snappy_basic "ut-snappy" "basic")
+set_tests_properties(snappy_basic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;275;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(tiny_sort "ut-tiny" "sort")
+set_tests_properties(tiny_sort PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;277;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(tiny_set "ut-tiny" "set")
+set_tests_properties(tiny_set PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;277;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(tiny_map "ut-tiny" "map")
+set_tests_properties(tiny_map PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;277;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(tiny_multiset "ut-tiny" "multiset")
+set_tests_properties(tiny_multiset PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;277;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(tiny_multimap "ut-tiny" "multimap")
+set_tests_properties(tiny_multimap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;277;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(raw_file_accessor_open_rw_new "ut-raw_file_accessor" "open_rw_new")
+set_tests_properties(raw_file_accessor_open_rw_new PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;279;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+add_test(raw_file_accessor_try_open_rw "ut-raw_file_accessor" "try_open_rw")
+set_tests_properties(raw_file_accessor_try_open_rw PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;17;add_test;/root/repo/test/unit/CMakeLists.txt;279;add_unittest;/root/repo/test/unit/CMakeLists.txt;0;")
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(ami_stream_stress "/root/repo/_debug_build/test/unit/ut-ami_stream" "stress")
+  set_tests_properties(ami_stream_stress PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;281;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(disjoint_set_large "/root/repo/_debug_build/test/unit/ut-disjoint_set" "large")
+  set_tests_properties(disjoint_set_large PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;282;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(disjoint_set_large_cycle "/root/repo/_debug_build/test/unit/ut-disjoint_set" "large_cycle")
+  set_tests_properties(disjoint_set_large_cycle PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;282;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(disjoint_set_very_large "/root/repo/_debug_build/test/unit/ut-disjoint_set" "very_large")
+  set_tests_properties(disjoint_set_very_large PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;282;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(disjoint_set_medium "/root/repo/_debug_build/test/unit/ut-disjoint_set" "medium")
+  set_tests_properties(disjoint_set_medium PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;282;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(disjoint_set_ovelflow "/root/repo/_debug_build/test/unit/ut-disjoint_set" "ovelflow")
+  set_tests_properties(disjoint_set_ovelflow PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;282;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(disjoint_set_stress "/root/repo/_debug_build/test/unit/ut-disjoint_set" "stress")
+  set_tests_properties(disjoint_set_stress PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;282;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(external_priority_queue_medium "/root/repo/_debug_build/test/unit/ut-external_priority_queue" "medium")
+  set_tests_properties(external_priority_queue_medium PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;283;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(external_priority_queue_large "/root/repo/_debug_build/test/unit/ut-external_priority_queue" "large")
+  set_tests_properties(external_priority_queue_large PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;283;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(external_priority_queue_large_cycle "/root/repo/_debug_build/test/unit/ut-external_priority_queue" "large_cycle")
+  set_tests_properties(external_priority_queue_large_cycle PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;283;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(external_priority_queue_memory "/root/repo/_debug_build/test/unit/ut-external_priority_queue" "memory")
+  set_tests_properties(external_priority_queue_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;283;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(external_priority_queue_overflow "/root/repo/_debug_build/test/unit/ut-external_priority_queue" "overflow")
+  set_tests_properties(external_priority_queue_overflow PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;283;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(external_priority_queue_very_large "/root/repo/_debug_build/test/unit/ut-external_priority_queue" "very_large")
+  set_tests_properties(external_priority_queue_very_large PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;283;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(external_sort_amilarge "/root/repo/_debug_build/test/unit/ut-external_sort" "amilarge")
+  set_tests_properties(external_sort_amilarge PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;284;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(external_sort_large "/root/repo/_debug_build/test/unit/ut-external_sort" "large")
+  set_tests_properties(external_sort_large PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;284;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(external_sort_tall "/root/repo/_debug_build/test/unit/ut-external_sort" "tall")
+  set_tests_properties(external_sort_tall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;284;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(external_sort_very_large "/root/repo/_debug_build/test/unit/ut-external_sort" "very_large")
+  set_tests_properties(external_sort_very_large PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;284;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(hashmap_speed "ut-hashmap" "speed")
+  set_tests_properties(hashmap_speed PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;285;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(internal_priority_queue_large_cycle "/root/repo/_debug_build/test/unit/ut-internal_priority_queue" "large_cycle")
+  set_tests_properties(internal_priority_queue_large_cycle PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;286;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(internal_vector_medium "/root/repo/_debug_build/test/unit/ut-internal_vector" "medium")
+  set_tests_properties(internal_vector_medium PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;287;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(internal_vector_large "/root/repo/_debug_build/test/unit/ut-internal_vector" "large")
+  set_tests_properties(internal_vector_large PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;287;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(memory_parallel "/root/repo/_debug_build/test/unit/ut-memory" "parallel")
+  set_tests_properties(memory_parallel PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;288;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(memory_parallel_malloc "/root/repo/_debug_build/test/unit/ut-memory" "parallel_malloc")
+  set_tests_properties(memory_parallel_malloc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;288;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(memory_parallel_stdnew "/root/repo/_debug_build/test/unit/ut-memory" "parallel_stdnew")
+  set_tests_properties(memory_parallel_stdnew PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;288;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(parallel_sort_general2 "/root/repo/_debug_build/test/unit/ut-parallel_sort" "general2")
+  set_tests_properties(parallel_sort_general2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;289;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(parallel_sort_large_item "/root/repo/_debug_build/test/unit/ut-parallel_sort" "large_item")
+  set_tests_properties(parallel_sort_large_item PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;289;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(parallel_sort_stress_test "/root/repo/_debug_build/test/unit/ut-parallel_sort" "stress_test")
+  set_tests_properties(parallel_sort_stress_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;289;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(pipelining_sortbig "/root/repo/_debug_build/test/unit/ut-pipelining" "sortbig")
+  set_tests_properties(pipelining_sortbig PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;290;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(pipelining_parallel_step "/root/repo/_debug_build/test/unit/ut-pipelining" "parallel_step")
+  set_tests_properties(pipelining_parallel_step PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;290;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(stream_stress "/root/repo/_debug_build/test/unit/ut-stream" "stress")
+  set_tests_properties(stream_stress PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;291;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(stream_stress_compressed "/root/repo/_debug_build/test/unit/ut-stream" "stress_compressed")
+  set_tests_properties(stream_stress_compressed PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;291;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
+if(CTEST_CONFIGURATION_TYPE MATCHES "^([Ff][Uu][Ll][Ll][Tt][Ee][Ss][Tt])$")
+  add_test(stream_stress_file "/root/repo/_debug_build/test/unit/ut-stream" "stress_file")
+  set_tests_properties(stream_stress_file PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/unit/CMakeLists.txt;25;add_test;/root/repo/test/unit/CMakeLists.txt;291;add_fulltest;/root/repo/test/unit/CMakeLists.txt;0;")
+endif()
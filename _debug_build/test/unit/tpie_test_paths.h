@@ -0,0 +1,2 @@
+#define TPIE_TEST_PATH "/root/repo/test/unit"
+
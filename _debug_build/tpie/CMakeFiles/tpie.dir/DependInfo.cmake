@@ -0,0 +1,59 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tpie/backtrace.cpp" "tpie/CMakeFiles/tpie.dir/backtrace.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/backtrace.cpp.o.d"
+  "/root/repo/tpie/blocks/block_collection.cpp" "tpie/CMakeFiles/tpie.dir/blocks/block_collection.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/blocks/block_collection.cpp.o.d"
+  "/root/repo/tpie/blocks/block_collection_cache.cpp" "tpie/CMakeFiles/tpie.dir/blocks/block_collection_cache.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/blocks/block_collection_cache.cpp.o.d"
+  "/root/repo/tpie/btree/external_store_base.cpp" "tpie/CMakeFiles/tpie.dir/btree/external_store_base.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/btree/external_store_base.cpp.o.d"
+  "/root/repo/tpie/compressed/buffer.cpp" "tpie/CMakeFiles/tpie.dir/compressed/buffer.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/compressed/buffer.cpp.o.d"
+  "/root/repo/tpie/compressed/request.cpp" "tpie/CMakeFiles/tpie.dir/compressed/request.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/compressed/request.cpp.o.d"
+  "/root/repo/tpie/compressed/scheme_none.cpp" "tpie/CMakeFiles/tpie.dir/compressed/scheme_none.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/compressed/scheme_none.cpp.o.d"
+  "/root/repo/tpie/compressed/scheme_snappy.cpp" "tpie/CMakeFiles/tpie.dir/compressed/scheme_snappy.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/compressed/scheme_snappy.cpp.o.d"
+  "/root/repo/tpie/compressed/stream_base.cpp" "tpie/CMakeFiles/tpie.dir/compressed/stream_base.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/compressed/stream_base.cpp.o.d"
+  "/root/repo/tpie/compressed/thread.cpp" "tpie/CMakeFiles/tpie.dir/compressed/thread.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/compressed/thread.cpp.o.d"
+  "/root/repo/tpie/cpu_timer.cpp" "tpie/CMakeFiles/tpie.dir/cpu_timer.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/cpu_timer.cpp.o.d"
+  "/root/repo/tpie/execution_time_predictor.cpp" "tpie/CMakeFiles/tpie.dir/execution_time_predictor.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/execution_time_predictor.cpp.o.d"
+  "/root/repo/tpie/file_base.cpp" "tpie/CMakeFiles/tpie.dir/file_base.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/file_base.cpp.o.d"
+  "/root/repo/tpie/file_manager.cpp" "tpie/CMakeFiles/tpie.dir/file_manager.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/file_manager.cpp.o.d"
+  "/root/repo/tpie/file_stream_base.cpp" "tpie/CMakeFiles/tpie.dir/file_stream_base.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/file_stream_base.cpp.o.d"
+  "/root/repo/tpie/fractional_progress.cpp" "tpie/CMakeFiles/tpie.dir/fractional_progress.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/fractional_progress.cpp.o.d"
+  "/root/repo/tpie/job.cpp" "tpie/CMakeFiles/tpie.dir/job.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/job.cpp.o.d"
+  "/root/repo/tpie/logstream.cpp" "tpie/CMakeFiles/tpie.dir/logstream.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/logstream.cpp.o.d"
+  "/root/repo/tpie/memory.cpp" "tpie/CMakeFiles/tpie.dir/memory.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/memory.cpp.o.d"
+  "/root/repo/tpie/pipelining/factory_base.cpp" "tpie/CMakeFiles/tpie.dir/pipelining/factory_base.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/pipelining/factory_base.cpp.o.d"
+  "/root/repo/tpie/pipelining/merge_sorter.cpp" "tpie/CMakeFiles/tpie.dir/pipelining/merge_sorter.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/pipelining/merge_sorter.cpp.o.d"
+  "/root/repo/tpie/pipelining/node.cpp" "tpie/CMakeFiles/tpie.dir/pipelining/node.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/pipelining/node.cpp.o.d"
+  "/root/repo/tpie/pipelining/node_name.cpp" "tpie/CMakeFiles/tpie.dir/pipelining/node_name.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/pipelining/node_name.cpp.o.d"
+  "/root/repo/tpie/pipelining/pipeline.cpp" "tpie/CMakeFiles/tpie.dir/pipelining/pipeline.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/pipelining/pipeline.cpp.o.d"
+  "/root/repo/tpie/pipelining/runtime.cpp" "tpie/CMakeFiles/tpie.dir/pipelining/runtime.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/pipelining/runtime.cpp.o.d"
+  "/root/repo/tpie/pipelining/sort_cost_model.cpp" "tpie/CMakeFiles/tpie.dir/pipelining/sort_cost_model.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/pipelining/sort_cost_model.cpp.o.d"
+  "/root/repo/tpie/pipelining/tokens.cpp" "tpie/CMakeFiles/tpie.dir/pipelining/tokens.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/pipelining/tokens.cpp.o.d"
+  "/root/repo/tpie/portability.cpp" "tpie/CMakeFiles/tpie.dir/portability.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/portability.cpp.o.d"
+  "/root/repo/tpie/progress_indicator_base.cpp" "tpie/CMakeFiles/tpie.dir/progress_indicator_base.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/progress_indicator_base.cpp.o.d"
+  "/root/repo/tpie/progress_indicator_subindicator.cpp" "tpie/CMakeFiles/tpie.dir/progress_indicator_subindicator.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/progress_indicator_subindicator.cpp.o.d"
+  "/root/repo/tpie/resource_manager.cpp" "tpie/CMakeFiles/tpie.dir/resource_manager.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/resource_manager.cpp.o.d"
+  "/root/repo/tpie/resources.cpp" "tpie/CMakeFiles/tpie.dir/resources.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/resources.cpp.o.d"
+  "/root/repo/tpie/serialization_stream.cpp" "tpie/CMakeFiles/tpie.dir/serialization_stream.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/serialization_stream.cpp.o.d"
+  "/root/repo/tpie/stats.cpp" "tpie/CMakeFiles/tpie.dir/stats.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/stats.cpp.o.d"
+  "/root/repo/_debug_build/tpie/sysinfo.cpp" "tpie/CMakeFiles/tpie.dir/sysinfo.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/sysinfo.cpp.o.d"
+  "/root/repo/tpie/sysinfo2.cpp" "tpie/CMakeFiles/tpie.dir/sysinfo2.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/sysinfo2.cpp.o.d"
+  "/root/repo/tpie/tempname.cpp" "tpie/CMakeFiles/tpie.dir/tempname.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/tempname.cpp.o.d"
+  "/root/repo/tpie/tpie.cpp" "tpie/CMakeFiles/tpie.dir/tpie.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/tpie.cpp.o.d"
+  "/root/repo/tpie/tpie_log.cpp" "tpie/CMakeFiles/tpie.dir/tpie_log.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/tpie_log.cpp.o.d"
+  "/root/repo/tpie/unittest.cpp" "tpie/CMakeFiles/tpie.dir/unittest.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/unittest.cpp.o.d"
+  "/root/repo/tpie/util.cpp" "tpie/CMakeFiles/tpie.dir/util.cpp.o" "gcc" "tpie/CMakeFiles/tpie.dir/util.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
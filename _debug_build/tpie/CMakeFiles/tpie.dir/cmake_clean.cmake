@@ -0,0 +1,91 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tpie.dir/backtrace.cpp.o"
+  "CMakeFiles/tpie.dir/backtrace.cpp.o.d"
+  "CMakeFiles/tpie.dir/blocks/block_collection.cpp.o"
+  "CMakeFiles/tpie.dir/blocks/block_collection.cpp.o.d"
+  "CMakeFiles/tpie.dir/blocks/block_collection_cache.cpp.o"
+  "CMakeFiles/tpie.dir/blocks/block_collection_cache.cpp.o.d"
+  "CMakeFiles/tpie.dir/btree/external_store_base.cpp.o"
+  "CMakeFiles/tpie.dir/btree/external_store_base.cpp.o.d"
+  "CMakeFiles/tpie.dir/compressed/buffer.cpp.o"
+  "CMakeFiles/tpie.dir/compressed/buffer.cpp.o.d"
+  "CMakeFiles/tpie.dir/compressed/request.cpp.o"
+  "CMakeFiles/tpie.dir/compressed/request.cpp.o.d"
+  "CMakeFiles/tpie.dir/compressed/scheme_none.cpp.o"
+  "CMakeFiles/tpie.dir/compressed/scheme_none.cpp.o.d"
+  "CMakeFiles/tpie.dir/compressed/scheme_snappy.cpp.o"
+  "CMakeFiles/tpie.dir/compressed/scheme_snappy.cpp.o.d"
+  "CMakeFiles/tpie.dir/compressed/stream_base.cpp.o"
+  "CMakeFiles/tpie.dir/compressed/stream_base.cpp.o.d"
+  "CMakeFiles/tpie.dir/compressed/thread.cpp.o"
+  "CMakeFiles/tpie.dir/compressed/thread.cpp.o.d"
+  "CMakeFiles/tpie.dir/cpu_timer.cpp.o"
+  "CMakeFiles/tpie.dir/cpu_timer.cpp.o.d"
+  "CMakeFiles/tpie.dir/execution_time_predictor.cpp.o"
+  "CMakeFiles/tpie.dir/execution_time_predictor.cpp.o.d"
+  "CMakeFiles/tpie.dir/file_base.cpp.o"
+  "CMakeFiles/tpie.dir/file_base.cpp.o.d"
+  "CMakeFiles/tpie.dir/file_manager.cpp.o"
+  "CMakeFiles/tpie.dir/file_manager.cpp.o.d"
+  "CMakeFiles/tpie.dir/file_stream_base.cpp.o"
+  "CMakeFiles/tpie.dir/file_stream_base.cpp.o.d"
+  "CMakeFiles/tpie.dir/fractional_progress.cpp.o"
+  "CMakeFiles/tpie.dir/fractional_progress.cpp.o.d"
+  "CMakeFiles/tpie.dir/job.cpp.o"
+  "CMakeFiles/tpie.dir/job.cpp.o.d"
+  "CMakeFiles/tpie.dir/logstream.cpp.o"
+  "CMakeFiles/tpie.dir/logstream.cpp.o.d"
+  "CMakeFiles/tpie.dir/memory.cpp.o"
+  "CMakeFiles/tpie.dir/memory.cpp.o.d"
+  "CMakeFiles/tpie.dir/pipelining/factory_base.cpp.o"
+  "CMakeFiles/tpie.dir/pipelining/factory_base.cpp.o.d"
+  "CMakeFiles/tpie.dir/pipelining/merge_sorter.cpp.o"
+  "CMakeFiles/tpie.dir/pipelining/merge_sorter.cpp.o.d"
+  "CMakeFiles/tpie.dir/pipelining/node.cpp.o"
+  "CMakeFiles/tpie.dir/pipelining/node.cpp.o.d"
+  "CMakeFiles/tpie.dir/pipelining/node_name.cpp.o"
+  "CMakeFiles/tpie.dir/pipelining/node_name.cpp.o.d"
+  "CMakeFiles/tpie.dir/pipelining/pipeline.cpp.o"
+  "CMakeFiles/tpie.dir/pipelining/pipeline.cpp.o.d"
+  "CMakeFiles/tpie.dir/pipelining/runtime.cpp.o"
+  "CMakeFiles/tpie.dir/pipelining/runtime.cpp.o.d"
+  "CMakeFiles/tpie.dir/pipelining/sort_cost_model.cpp.o"
+  "CMakeFiles/tpie.dir/pipelining/sort_cost_model.cpp.o.d"
+  "CMakeFiles/tpie.dir/pipelining/tokens.cpp.o"
+  "CMakeFiles/tpie.dir/pipelining/tokens.cpp.o.d"
+  "CMakeFiles/tpie.dir/portability.cpp.o"
+  "CMakeFiles/tpie.dir/portability.cpp.o.d"
+  "CMakeFiles/tpie.dir/progress_indicator_base.cpp.o"
+  "CMakeFiles/tpie.dir/progress_indicator_base.cpp.o.d"
+  "CMakeFiles/tpie.dir/progress_indicator_subindicator.cpp.o"
+  "CMakeFiles/tpie.dir/progress_indicator_subindicator.cpp.o.d"
+  "CMakeFiles/tpie.dir/resource_manager.cpp.o"
+  "CMakeFiles/tpie.dir/resource_manager.cpp.o.d"
+  "CMakeFiles/tpie.dir/resources.cpp.o"
+  "CMakeFiles/tpie.dir/resources.cpp.o.d"
+  "CMakeFiles/tpie.dir/serialization_stream.cpp.o"
+  "CMakeFiles/tpie.dir/serialization_stream.cpp.o.d"
+  "CMakeFiles/tpie.dir/stats.cpp.o"
+  "CMakeFiles/tpie.dir/stats.cpp.o.d"
+  "CMakeFiles/tpie.dir/sysinfo.cpp.o"
+  "CMakeFiles/tpie.dir/sysinfo.cpp.o.d"
+  "CMakeFiles/tpie.dir/sysinfo2.cpp.o"
+  "CMakeFiles/tpie.dir/sysinfo2.cpp.o.d"
+  "CMakeFiles/tpie.dir/tempname.cpp.o"
+  "CMakeFiles/tpie.dir/tempname.cpp.o.d"
+  "CMakeFiles/tpie.dir/tpie.cpp.o"
+  "CMakeFiles/tpie.dir/tpie.cpp.o.d"
+  "CMakeFiles/tpie.dir/tpie_log.cpp.o"
+  "CMakeFiles/tpie.dir/tpie_log.cpp.o.d"
+  "CMakeFiles/tpie.dir/unittest.cpp.o"
+  "CMakeFiles/tpie.dir/unittest.cpp.o.d"
+  "CMakeFiles/tpie.dir/util.cpp.o"
+  "CMakeFiles/tpie.dir/util.cpp.o.d"
+  "libtpie.a"
+  "libtpie.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tpie.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
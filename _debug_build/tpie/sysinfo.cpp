@@ -0,0 +1,31 @@
+// -*- mode: c++; tab-width: 4; indent-tabs-mode: t; c-file-style: "stroustrup"; -*-
+// vi:set ts=4 sts=4 sw=4 noet :
+// Copyright 2012, The TPIE development team
+// 
+// This file is part of TPIE.
+// 
+// TPIE is free software: you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or (at your
+// option) any later version.
+// 
+// TPIE is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+// 
+// You should have received a copy of the GNU Lesser General Public License
+// along with TPIE.  If not, see <http://www.gnu.org/licenses/>
+
+// http://stackoverflow.com/a/4318642
+
+#include <tpie/tpie_export.h>
+
+namespace tpie {
+
+#define GIT_COMMIT "2d06a169ff4c0de01812c957e191259ed96b68a9"
+#define GIT_REFSPEC "refs/heads/master"
+TPIE_EXPORT const char * git_commit = GIT_COMMIT;
+TPIE_EXPORT const char * git_refspec = GIT_REFSPEC;
+
+}
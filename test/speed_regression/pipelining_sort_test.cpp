@@ -58,12 +58,26 @@ struct item {
 
 typedef item test_t;
 
+// The alternative to a stable sort: widen each item by its input position
+// and break ties on it.
+struct tagged_item {
+	item x;
+	uint64_t seq;
+
+	bool operator<(const tagged_item & other) const {
+		if (x < other.x) return true;
+		if (other.x < x) return false;
+		return seq < other.seq;
+	}
+};
+
 struct testparams {
 	stream_size_type elements;
 	size_t times;
 	memory_size_type runLength;
 	size_t fanout;
 	memory_size_type memoryLimit;
+	bool stable;
 };
 
 void parse_args(int argc, char ** argv, testparams & p) {
@@ -82,8 +96,12 @@ void parse_args(int argc, char ** argv, testparams & p) {
 			std::stringstream ss(argv[i+1]);
 			ss >> p.memoryLimit;
 			i += 2;
+		} else if (arg == "-s") {
+			p.stable = true;
+			++i;
 		} else if (arg == "-h" || arg == "--help") {
-			std::cout << "Usage: " << argv[0] << " [-r runLength] [-f fanout] [-m memoryLimit] <elements> <times>" << std::endl;
+			std::cout << "Usage: " << argv[0] << " [-r runLength] [-f fanout] [-m memoryLimit] [-s] <elements> <times>" << std::endl
+					  << "  -s: Compare a stable sort to a sort of items tagged with their position" << std::endl;
 			exit(1);
 		} else break;
 	}
@@ -149,8 +167,77 @@ void test(testparams & p) {
 	}
 }
 
+// Sort with many equal keys and return whether equal keys kept their order.
+template <typename T, typename F>
+bool sort_duplicates(testparams & p, bool stable, F make) {
+	merge_sorter<T, false> m;
+	m.set_available_memory(p.memoryLimit);
+	if (p.runLength) {
+		m.set_parameters(p.runLength, p.fanout);
+	}
+	m.set_stable(stable);
+	m.begin();
+	const uint32_t keys = static_cast<uint32_t>(std::max(p.elements / 16, stream_size_type(1)));
+	for (stream_size_type j = 0; j < p.elements; ++j) {
+		item x = item();
+		x = static_cast<uint32_t>((j * 2654435761u) % keys);
+		x.b = static_cast<uint32_t>(j);
+		m.push(make(x, j));
+	}
+	m.end();
+	dummy_progress_indicator pi;
+	m.calc(pi);
+	bool good = true;
+	item prev = item();
+	for (stream_size_type j = 0; j < p.elements; ++j) {
+		item y = m.pull().x;
+		if (j > 0 && (y < prev || (!(prev < y) && y.b < prev.b))) good = false;
+		prev = y;
+	}
+	return good;
+}
+
+struct stable_item {
+	item x;
+
+	bool operator<(const stable_item & other) const {
+		return x < other.x;
+	}
+};
+
+void stable_test(testparams & p) {
+	std::vector<const char *> names(4);
+	names[0] = "Stable";
+	names[1] = "Tagged";
+	names[2] = "Correct";
+	names[3] = "Correct";
+	tpie::test::stat stats(names);
+	for (size_t i = 0; i < p.times; ++i) {
+		test_realtime_t start;
+		test_realtime_t end;
+
+		getTestRealtime(start);
+		bool stableGood = sort_duplicates<stable_item>(p, true, [](item x, stream_size_type) {
+			stable_item r = {x};
+			return r;
+		});
+		getTestRealtime(end);
+		stats(testRealtimeDiff(start, end));
+
+		getTestRealtime(start);
+		bool taggedGood = sort_duplicates<tagged_item>(p, false, [](item x, stream_size_type j) {
+			tagged_item r = {x, j};
+			return r;
+		});
+		getTestRealtime(end);
+		stats(testRealtimeDiff(start, end));
+		stats(stableGood ? 1 : 0);
+		stats(taggedGood ? 1 : 0);
+	}
+}
+
 int main(int argc, char ** argv) {
-	testparams p = {10, 1, 0, 0, 50*1024*1024};
+	testparams p = {10, 1, 0, 0, 50*1024*1024, false};
 	parse_args(argc, argv, p);
 	testinfo t("Pipelining sort speed test", 1024, 0, p.times);
 	sysinfo s;
@@ -162,6 +249,9 @@ int main(int argc, char ** argv) {
 		s.printinfo("Run length", "(default)");
 		s.printinfo("Fanout", "(default)");
 	}
-	::test(p);
+	if (p.stable)
+		stable_test(p);
+	else
+		::test(p);
 	return 0;
 }
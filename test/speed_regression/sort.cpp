@@ -23,6 +23,9 @@
 #include <tpie/tpie.h>
 #include <tpie/stream.h>
 #include <tpie/sort.h>
+#include <tpie/sort_manager.h>
+#include <tpie/internal_sort.h>
+#include <tpie/mergeheap.h>
 #include <iostream>
 #include "testtime.h"
 #include "stat.h"
@@ -42,12 +45,31 @@ void usage() {
 	std::cout << "Parameters: [times] [mb] [memory]" << std::endl;
 }
 
+typedef std::less<elm_t> comp_t;
+typedef ami::Internal_Sorter_Obj<elm_t, comp_t> legacy_internal_sorter_t;
+typedef ami::merge_heap_obj<elm_t, comp_t> legacy_merge_heap_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// Sort in-place with the sort_manager that tpie::sort used before it was
+/// based on merge_sorter, for comparison.
+///////////////////////////////////////////////////////////////////////////////
+void legacy_sort(const std::string & path) {
+	comp_t comp;
+	legacy_internal_sorter_t internalSorter(comp);
+	legacy_merge_heap_t mergeHeap(comp);
+	sort_manager<elm_t, legacy_internal_sorter_t, legacy_merge_heap_t> manager(&internalSorter, &mergeHeap);
+	file_stream<elm_t> s;
+	s.open(path);
+	manager.sort(&s);
+}
+
 void test(size_t mb, size_t times) {
 	std::vector<const char *> names;
-	names.resize(3);
+	names.resize(4);
 	names[0] = "Write";
 	names[1] = "Sort";
-	names[2] = "Hash";
+	names[2] = "Legacy";
+	names[3] = "Hash";
 	tpie::test::stat s(names);
 	count_t count=static_cast<count_t>(mb)*1024*1024/sizeof(elm_t);
 	for (size_t i=0; i < times; ++i) {
@@ -56,6 +78,7 @@ void test(size_t mb, size_t times) {
 		test_realtime_t end;
 
 		temp_file tmp;
+		temp_file legacyTmp;
 
 		//The purpose of this test is to test the speed of the io calls, not the file system
 		getTestRealtime(start);
@@ -68,6 +91,7 @@ void test(size_t mb, size_t times) {
 		}
 		getTestRealtime(end);
 		s(testRealtimeDiff(start,end));
+		std::filesystem::copy_file(tmp.path(), legacyTmp.path(), std::filesystem::copy_options::overwrite_existing);
 		
 		getTestRealtime(start);
 		{
@@ -77,6 +101,11 @@ void test(size_t mb, size_t times) {
 		getTestRealtime(end);
 		s(testRealtimeDiff(start,end));
 
+		getTestRealtime(start);
+		legacy_sort(legacyTmp.path());
+		getTestRealtime(end);
+		s(testRealtimeDiff(start,end));
+
 		elm_t hash = 0;
 		elm_t prev = 0;
 		bool sorted = true;
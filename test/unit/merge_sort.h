@@ -76,7 +76,8 @@ static bool sort_test(memory_size_type m1,
 					  memory_size_type extraMemory = 0,
 					  bool evacuateBeforeMerge = false,
 					  bool evacuateBeforeReport = false,
-					  memory_size_type file_limit = 0)
+					  memory_size_type file_limit = 0,
+					  run_formation_type runFormation = run_formation_sort)
 {
 	m1 *= 1024*1024;
 	m2 *= 1024*1024;
@@ -90,6 +91,7 @@ static bool sort_test(memory_size_type m1,
 	sorter s;
 	s.set_available_memory(m1, m2, m3);
 	s.set_available_files(file_limit);
+	s.set_run_formation(runFormation);
 
 	log_debug() << "Begin phase 1" << std::endl;
 	m.set_threshold(m1);
@@ -179,6 +181,33 @@ static bool evacuate_before_report_test() {
 	return sort_test(20,20,20,50, 0, false, true);
 }
 
+static bool replacement_selection_test() {
+	return sort_test(20,20,20,50, 0, false, false, 0, run_formation_replacement_selection);
+}
+
+static stream_size_type count_runs(run_formation_type runFormation, double mb_data) {
+	item_generator gen(static_cast<stream_size_type>(mb_data*(1024*1024)));
+	const stream_size_type items = gen.items();
+	sorter s;
+	s.set_available_memory(5*1024*1024, 20*1024*1024, 20*1024*1024);
+	s.set_run_formation(runFormation);
+	s.begin();
+	for (stream_size_type i = 0; i < items; ++i) s.push(gen());
+	s.end();
+	return s.run_count();
+}
+
+static bool replacement_selection_run_count_test(double mb_data) {
+	// On random input, replacement selection forms runs that are about twice
+	// as long as the item buffer, so it should need about half as many runs.
+	const stream_size_type sortRuns = count_runs(run_formation_sort, mb_data);
+	const stream_size_type selectionRuns = count_runs(run_formation_replacement_selection, mb_data);
+	log_debug() << "Sort: " << sortRuns << " runs, replacement selection: " << selectionRuns << " runs" << std::endl;
+	TEST_ENSURE(sortRuns >= 8, "Too few runs to compare run formation methods");
+	TEST_ENSURE(selectionRuns * 5 <= sortRuns * 3 + 5, "Replacement selection runs are not about twice the buffer size");
+	return true;
+}
+
 static bool file_limit_test(int limit) {
 	get_file_manager().set_limit(limit);
 	get_file_manager().set_enforcement(file_manager::ENFORCE_THROW);
@@ -202,6 +231,8 @@ static tests & add_all(tests & t) {
 #endif
 		.test(evacuate_before_merge_test, "evacuate_before_merge")
 		.test(evacuate_before_report_test, "evacuate_before_report")
+		.test(replacement_selection_test, "replacement_selection")
+		.test(replacement_selection_run_count_test, "replacement_selection_run_count", "mb", 40.0)
 		;
 }
 
@@ -21,6 +21,8 @@
 #include <tpie/tpie.h>
 #include <tpie/btree.h>
 #include <tpie/tempname.h>
+#include <tpie/pipelining.h>
+#include <tpie/pipelining/btree.h>
 #include <algorithm>
 #include <set>
 #include <map>
@@ -416,6 +418,30 @@ bool build_test(TA<TT...> ta, A && ... a) {
 }
 
 
+template<typename ... TT, typename ... A>
+bool sort_into_test(TA<TT...> ta, A && ... a) {
+	default_comp c;
+	ss_augmenter au;
+	auto builder = get_builder(ta, c, au, std::forward<A>(a)...);
+	set<int> tree2;
+
+	std::vector<int> x;
+	for (int i=0; i < 50000; ++i) {
+		x.push_back(i);
+		tree2.insert(i);
+	}
+	std::random_shuffle(x.begin(), x.end());
+
+	pipelining::pipeline p = pipelining::input_vector(x) | pipelining::sort_into_btree(builder);
+	p();
+
+	auto tree = builder.build();
+	TEST_ENSURE_EQUALITY(tree2.size(), tree.size(), "The tree has the wrong size");
+	TEST_ENSURE(compare(tree, tree2), "Compare failed");
+
+	return true;
+}
+
 template<typename ... TT, typename ... A>
 bool unordered_test(TA<TT...>, A && ... a) {
 	struct item {
@@ -578,6 +604,11 @@ bool external_build_test() {
     return build_test(TA<btree_external>(), tmp.path());
 }
 
+bool external_sort_into_test() {
+	temp_file tmp;
+	return sort_into_test(TA<btree_external>(), tmp.path());
+}
+
 bool external_bound_test() {
 	temp_file tmp;
 	return bound_test(TA<btree_external>(), tmp.path());
@@ -603,6 +634,59 @@ bool serialized_build_test() {
     return build_test(TA<btree_external, btree_serialized, btree_static>(), tmp.path());
 }
 
+bool serialized_sort_into_test() {
+	temp_file tmp;
+	return sort_into_test(TA<btree_external, btree_serialized, btree_static>(), tmp.path());
+}
+
+struct named_item {
+	int key;
+	std::string name;
+	bool operator==(const named_item & o) const {return key == o.key && name == o.name;}
+	bool operator!=(const named_item & o) const {return !(*this == o);}
+	bool operator<(const named_item & o) const {return key < o.key;}
+};
+
+template <typename D>
+void serialize(D & dst, const named_item & i) {
+	using tpie::serialize;
+	serialize(dst, i.key);
+	serialize(dst, i.name);
+}
+
+template <typename S>
+void unserialize(S & src, named_item & i) {
+	using tpie::unserialize;
+	unserialize(src, i.key);
+	unserialize(src, i.name);
+}
+
+struct named_item_key {
+	int operator()(const named_item & i) const {return i.key;}
+};
+
+bool serialized_string_sort_into_test() {
+	temp_file tmp;
+	btree_builder<named_item, btree_key<named_item_key>, btree_external, btree_serialized, btree_static> builder(tmp.path());
+	set<named_item> tree2;
+
+	std::vector<named_item> x;
+	for (int i=0; i < 20000; ++i) {
+		int k = i * 7919 % 20000;
+		x.push_back(named_item{k, std::to_string(k) + std::string(k % 13, 'x')});
+		tree2.insert(x.back());
+	}
+
+	pipelining::pipeline p = pipelining::input_vector(x) | pipelining::sort_into_btree(builder);
+	p();
+
+	auto tree = builder.build();
+	TEST_ENSURE_EQUALITY(tree2.size(), tree.size(), "The tree has the wrong size");
+	TEST_ENSURE(compare(tree, tree2), "Compare failed");
+
+	return true;
+}
+
 bool serialized_reopen_test() {
 	temp_file tmp;
 	return reopen_test(TA<btree_external, btree_serialized, btree_static>(), tmp.path());
@@ -682,11 +766,14 @@ int main(int argc, char **argv) {
 		.test(external_key_and_comparator_test, "external_key_and_compare")
 		.test(external_augment_test, "external_augment")
         .test(external_build_test, "external_build")
+		.test(external_sort_into_test, "external_sort_into")
 		.test(external_bound_test, "external_bound")
 		.test(external_reopen_test, "external_reopen")
 		.test(external_static_reopen_test, "external_static_reopen")
 		.test(external_static_iterator_test, "external_static_iterator")
 		.test(serialized_build_test, "serialized_build")
+		.test(serialized_sort_into_test, "serialized_sort_into")
+		.test(serialized_string_sort_into_test, "serialized_string_sort_into")
 		.test(serialized_reopen_test, "serialized_reopen")
 		.test(serialized_iterator_test, "serialized_iterator")
         .test(serialized_lz4_build_test, "serialized_lz4_build")
@@ -735,6 +735,44 @@ static bool uncompressed_new_test(size_t n) {
 	return true;
 }
 
+static bool prefetch_test(size_t n) {
+	typedef tpie::file_stream<size_t> stream_t;
+	const size_t blockItems = 1024;
+	const size_t blocks = (n + blockItems - 1) / blockItems;
+	tpie::temp_file tf;
+	stream_t s(stream_t::calculate_block_factor(blockItems * sizeof(size_t)));
+	s.open(tf, tpie::access_read_write, 0, tpie::access_sequential, flags);
+	for (size_t i = 0; i < n; ++i) s.write(i);
+	s.seek(0);
+	stream_t::add_prefetch_buffers(1);
+	size_t prefetched = 0;
+	tpie::stream_position pos;
+	for (size_t i = 0; i < n; ++i) {
+		if (i == 3 * blockItems) pos = s.get_position();
+		TEST_ASSERT(s.read() == i);
+		size_t buffered = s.buffered_items();
+		TEST_ASSERT(buffered == std::min(blockItems - 1 - i % blockItems, n - 1 - i));
+		if (buffered > 0)
+			TEST_ASSERT(s.last_buffered_item() == i + buffered);
+		if (i % blockItems == 0 && s.prefetch_next_block()) ++prefetched;
+	}
+	TEST_ASSERT(prefetched == blocks - 1);
+	TEST_ASSERT(!s.prefetch_next_block());
+
+	// Seek away from a block that is being read ahead.
+	s.seek(0);
+	TEST_ASSERT(s.read() == 0);
+	TEST_ASSERT(s.prefetch_next_block());
+	s.set_position(pos);
+	for (size_t i = 3 * blockItems; i < n; ++i) TEST_ASSERT(s.read() == i);
+	s.seek(0);
+	TEST_ASSERT(s.read() == 0);
+	TEST_ASSERT(s.prefetch_next_block());
+	s.close();
+	stream_t::remove_prefetch_buffers(1);
+	return true;
+}
+
 static bool backwards_test(size_t n) {
 	// TODO: Fix this test with compression
 	// Skip this test if compression is on
@@ -1027,6 +1065,7 @@ tpie::tests & add_tests(tpie::tests & t, std::string suffix) {
 		.test(T::uncompressed_test, "uncompressed" + suffix, "n", static_cast<size_t>(1000000))
 		.test(T::uncompressed_new_test, "uncompressed_new" + suffix, "n", static_cast<size_t>(1000000))
 		.test(T::backwards_test, "backwards" + suffix, "n", static_cast<size_t>(1 << 23))
+		.test(T::prefetch_test, "prefetch" + suffix, "n", static_cast<size_t>(100000))
 		;
 }
 
@@ -19,6 +19,8 @@
 #include "common.h"
 #include <tpie/priority_queue.h>
 #include <vector>
+#include <set>
+#include <random>
 #include "priority_queue.h"
 #include "../test_portability.h"
 
@@ -291,6 +293,63 @@ bool remove_group_buffer_test(memory_size_type mmAvail, memory_size_type blockSi
 	return cyclic_pq_test(pq, items, iterations);
 }
 
+template <typename PQ>
+bool batch_pq_test(PQ & pq, stream_size_type iterations, memory_size_type maxBatch) {
+	std::multiset<uint64_t> pq2;
+	std::mt19937 rnd(42);
+	std::vector<uint64_t> batch;
+	std::vector<uint64_t> out;
+	for (stream_size_type i = 0; i < iterations; ++i) {
+		TEST_ENSURE_EQUALITY(pq2.size(), pq.size(), "Size differs");
+		memory_size_type n = rnd() % maxBatch + 1;
+		switch (rnd() % 4) {
+			case 0:
+			case 1:
+				batch.clear();
+				for (memory_size_type j = 0; j < n; ++j) batch.push_back(rnd() % 1000000);
+				pq.push_batch(batch.begin(), batch.end());
+				pq2.insert(batch.begin(), batch.end());
+				break;
+			case 2:
+				out.clear();
+				pq.pop_batch(std::back_inserter(out), n);
+				TEST_ENSURE_EQUALITY(std::min<size_t>(n, out.size() + pq2.size()), out.size(), "Wrong number of items popped");
+				for (uint64_t x : out) {
+					TEST_ENSURE_EQUALITY(*pq2.begin(), x, "Wrong item popped");
+					pq2.erase(pq2.begin());
+				}
+				break;
+			case 3: {
+				if (pq2.empty()) break;
+				uint64_t bound = *pq2.begin() + rnd() % 2000;
+				out.clear();
+				pq.pop_batch_until(std::back_inserter(out), bound);
+				for (uint64_t x : out) {
+					TEST_ENSURE_EQUALITY(*pq2.begin(), x, "Wrong item popped");
+					pq2.erase(pq2.begin());
+				}
+				TEST_ENSURE(pq2.empty() || *pq2.begin() > bound, "Not all items up to the bound were popped");
+				break;
+			}
+		}
+		if (!pq2.empty()) {
+			TEST_ENSURE_EQUALITY(*pq2.begin(), pq.top(), "Top element differs");
+		}
+	}
+	return true;
+}
+
+bool batch_test(memory_size_type mmAvail, stream_size_type iterations, memory_size_type maxBatch) {
+	// Small blocks so that many slots and groups fit in mmAvail
+	tpie::priority_queue<uint64_t> pq(mmAvail, float(1<<12) / (1<<21));
+	return batch_pq_test(pq, iterations, maxBatch);
+}
+
+bool batch_internal_test(stream_size_type iterations, memory_size_type maxBatch) {
+	tpie::priority_queue<uint64_t> pq(consecutive_memory_available(), 0.0625f, iterations * maxBatch);
+	return batch_pq_test(pq, iterations, maxBatch);
+}
+
 int main(int argc, char **argv) {
 	return tpie::tests(argc, argv, 128)
 		.test(basic_test, "basic")
@@ -301,6 +360,13 @@ int main(int argc, char **argv) {
 		.test(very_large_test<(1ull<<32) + 15, uint64_t>, "very_large")
 		.test(overflow_test, "overflow")
 		.test(parameter_test<uint64_t>, "parameters", "kb", 50000.0, "bs_kb", 128.0)
+		.test(batch_test, "batch",
+			  "mmavail", static_cast<memory_size_type>(1<<18),
+			  "iterations", static_cast<stream_size_type>(1000),
+			  "maxbatch", static_cast<memory_size_type>(5000))
+		.test(batch_internal_test, "batch_internal",
+			  "iterations", static_cast<stream_size_type>(2000),
+			  "maxbatch", static_cast<memory_size_type>(1000))
 		.test(remove_group_buffer_test<uint64_t>, "remove_group_buffer",
 			  "mmavail", static_cast<memory_size_type>((1<<14) + (1<<13) + (1<<12) + (1<<10) + (1<<7)),
 			  "blocksize", static_cast<memory_size_type>(1<<9),
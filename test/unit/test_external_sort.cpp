@@ -241,6 +241,33 @@ bool test2(uint64_t size) {
 	return true;
 }
 
+bool out_of_place_test(size_t n) {
+	temp_file inTmp;
+	temp_file outTmp;
+	file_stream<size_t> in;
+	file_stream<size_t> out;
+	in.open(inTmp.path());
+	out.open(outTmp.path());
+	primeit begin = primeit::begin(n);
+	primeit end = primeit::end(n);
+	size_t s = static_cast<size_t>(end-begin);
+	in.write(begin, end);
+	// Stale contents of the output stream must be overwritten.
+	for (size_t i = 0; i < 10; ++i) out.write(i);
+	progress_indicator_null pi(1);
+	sort(in, out, std::greater<size_t>(), pi);
+
+	TEST_ENSURE_EQUALITY(s, in.size(), "Input stream changed size");
+	in.seek(0);
+	for (primeit i = begin; i != end; ++i)
+		TEST_ENSURE_EQUALITY(*i, in.read(), "Input stream changed");
+	TEST_ENSURE_EQUALITY(s, out.size(), "Wrong output size");
+	out.seek(0);
+	for (size_t i = 0; i < s; ++i)
+		TEST_ENSURE_EQUALITY(s-1-i, out.read(), "Wrong output");
+	return true;
+}
+
 bool large_test(size_t n) {
 	progress_indicator_arrow pi("Sort", n, tpie::log_info());
 	return sort_test(n, pi);
@@ -257,6 +284,7 @@ int main(int argc, char **argv) {
 	return tpie::tests(argc, argv)
 		.multi_test(tiny_test, "tiny", "n", 5)
 		.test(small_test, "small", "n", 8*1024*1024)
+		.test(out_of_place_test, "out_of_place", "n", 1024*1024)
 		.test(tall_test, "tall", "n", 22*1024*1024)
 		.test(large_test, "large", "n", 128*1024*1024)
 		.test(ami_sort_test, "amismall", "n", 8*1024*1024)
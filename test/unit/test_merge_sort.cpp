@@ -19,6 +19,7 @@
 
 #include "common.h"
 #include <tpie/pipelining/merge_sorter.h>
+#include <tpie/pipelining/sort_cost_model.h>
 #include <tpie/parallel_sort.h>
 #include <tpie/sysinfo.h>
 #include <random>
@@ -158,6 +159,389 @@ bool tall_tree_test(size_t fanout, size_t height) {
 	return true;
 }
 
+bool replacement_selection_sorted_input_test(bool ascending) {
+	const memory_size_type runLength = get_block_size() / sizeof(size_t);
+	const memory_size_type fanout = 4;
+	const size_t items = 16 * runLength;
+	merge_sorter<size_t, false> s;
+	s.set_parameters(runLength, fanout);
+	s.set_run_formation(run_formation_replacement_selection);
+	s.begin();
+	for (size_t i = 0; i < items; ++i) {
+		// Ascending input with a few local swaps, or descending input, which
+		// is the worst case for replacement selection.
+		s.push(ascending ? (i ^ 1) : items - i);
+	}
+	s.end();
+	stream_size_type io = get_bytes_written();
+	dummy_progress_indicator pi;
+	s.calc(pi);
+	if (ascending) {
+		TEST_ENSURE_EQUALITY(io, get_bytes_written(), "Presorted input should form a single run and not be merged");
+	}
+	size_t prev = 0;
+	size_t read = 0;
+	while (s.can_pull()) {
+		size_t x = s.pull();
+		TEST_ENSURE(prev <= x, "Out of order");
+		prev = x;
+		++read;
+	}
+	TEST_ENSURE_EQUALITY(items, read, "Wrong number of items");
+	return true;
+}
+
+bool sorted_segments_test(size_t segments, bool aligned) {
+	const memory_size_type runLength = get_block_size() / sizeof(size_t);
+	const memory_size_type fanout = 4;
+	// When the segments are not aligned to the run buffer, a segment ends
+	// inside a buffer that also holds the start of the next segment.
+	const size_t segmentLength = 5 * runLength + (aligned ? 0 : runLength / 3);
+	const size_t items = segments * segmentLength;
+	merge_sorter<size_t, false> s;
+	s.set_parameters(runLength, fanout);
+	s.begin();
+	for (size_t i = 0; i < items; ++i) s.push(i % segmentLength);
+	s.end();
+	TEST_ENSURE_EQUALITY(segments, s.run_count(), "Wrong number of runs");
+	stream_size_type io = get_bytes_written();
+	dummy_progress_indicator pi;
+	s.calc(pi);
+	// Each sorted segment should form a single run, so no merging is needed
+	// and only run bookkeeping is written.
+	TEST_ENSURE(get_bytes_written() - io < runLength * sizeof(size_t), "Sorted segments were merged");
+	size_t prev = 0;
+	size_t read = 0;
+	while (s.can_pull()) {
+		size_t x = s.pull();
+		TEST_ENSURE(prev <= x, "Out of order");
+		prev = x;
+		++read;
+	}
+	TEST_ENSURE_EQUALITY(items, read, "Wrong number of items");
+	return true;
+}
+
+struct wide_item {
+	uint64_t key;
+	uint64_t tie;
+	char payload[240];
+};
+
+struct wide_item_less {
+	bool operator()(const wide_item & a, const wide_item & b) const {
+		return a.key < b.key || (a.key == b.key && a.tie < b.tie);
+	}
+};
+
+namespace tpie {
+template <>
+struct key_prefix<wide_item, wide_item_less> {
+	static const bool enabled = true;
+	typedef uint32_t prefix_type;
+	// Coarse prefix, so the full comparator breaks many ties.
+	static prefix_type prefix(const wide_item & item) {
+		return static_cast<prefix_type>(item.key >> 8);
+	}
+};
+} // namespace tpie
+
+bool key_prefix_test(size_t items) {
+	const memory_size_type runLength = 1000;
+	const memory_size_type fanout = 4;
+	merge_sorter<wide_item, false, wide_item_less> s;
+	s.set_parameters(runLength, fanout);
+	std::mt19937 rng(42);
+	s.begin();
+	for (size_t i = 0; i < items; ++i) {
+		wide_item x;
+		x.key = rng() % (items * 4);
+		x.tie = i;
+		std::fill(x.payload, x.payload + sizeof(x.payload), static_cast<char>(x.key ^ x.tie));
+		s.push(x);
+	}
+	s.end();
+	if (items > runLength)
+		TEST_ENSURE_EQUALITY((items + runLength - 1) / runLength, s.run_count(), "Wrong number of runs");
+	dummy_progress_indicator pi;
+	s.calc(pi);
+	wide_item_less less;
+	wide_item prev;
+	size_t read = 0;
+	while (s.can_pull()) {
+		wide_item x = s.pull();
+		TEST_ENSURE(read == 0 || less(prev, x), "Out of order");
+		for (size_t i = 0; i < sizeof(x.payload); ++i)
+			TEST_ENSURE_EQUALITY(static_cast<char>(x.key ^ x.tie), x.payload[i], "Payload does not follow its key");
+		prev = x;
+		++read;
+	}
+	TEST_ENSURE_EQUALITY(items, read, "Wrong number of items");
+	return true;
+}
+
+struct key_count {
+	uint64_t key;
+	uint64_t count;
+};
+
+struct key_count_less {
+	bool operator()(const key_count & a, const key_count & b) const {
+		return a.key < b.key;
+	}
+};
+
+struct key_count_sum {
+	key_count operator()(const key_count & a, const key_count & b) const {
+		key_count r = {a.key, a.count + b.count};
+		return r;
+	}
+};
+
+// Sort keys*duplicates items and return the number of bytes written while
+// merging, or zero if the output is wrong.
+template <typename pred_t>
+stream_size_type sort_key_counts(size_t keys, size_t duplicates) {
+	const bool combining = bits::sort_combiner<pred_t>::enabled;
+	const memory_size_type runLength = 1000;
+	const memory_size_type fanout = 4;
+	merge_sorter<key_count, false, pred_t> s;
+	s.set_parameters(runLength, fanout);
+	s.begin();
+	std::mt19937 rng(7);
+	for (size_t i = 0; i < keys * duplicates; ++i) {
+		key_count x = {rng() % keys, 1};
+		s.push(x);
+	}
+	s.end();
+	stream_size_type io = get_bytes_written();
+	dummy_progress_indicator pi;
+	s.calc(pi);
+	io = get_bytes_written() - io;
+	size_t total = 0;
+	size_t groups = 0;
+	uint64_t prev = 0;
+	while (s.can_pull()) {
+		key_count x = s.pull();
+		if (groups > 0 && (x.key < prev || (combining && x.key == prev))) {
+			log_error() << "Key " << x.key << " after " << prev << std::endl;
+			return 0;
+		}
+		prev = x.key;
+		total += x.count;
+		++groups;
+	}
+	if (total != keys * duplicates || (combining && groups > keys)) {
+		log_error() << "Got " << groups << " groups with " << total << " items" << std::endl;
+		return 0;
+	}
+	return io;
+}
+
+bool combine_test(size_t keys, size_t duplicates) {
+	stream_size_type plain = sort_key_counts<key_count_less>(keys, duplicates);
+	stream_size_type combined = sort_key_counts<combining_pred<key_count_less, key_count_sum> >(keys, duplicates);
+	TEST_ENSURE(plain > 0 && combined > 0, "Wrong result");
+	log_info() << "Merging wrote " << plain << " bytes; combining merges wrote " << combined << " bytes" << std::endl;
+	TEST_ENSURE(2 * combined < plain, "Combining did not reduce I/O");
+	return true;
+}
+
+bool combine_internal_test() {
+	typedef combining_pred<key_count_less, key_count_sum> pred_t;
+	merge_sorter<key_count, false, pred_t> s;
+	s.set_available_memory(50*1024*1024);
+	s.begin();
+	for (size_t i = 0; i < 1000; ++i) {
+		key_count x = {i % 10, 1};
+		s.push(x);
+	}
+	s.end();
+	dummy_progress_indicator pi;
+	s.calc(pi);
+	uint64_t key = 0;
+	while (s.can_pull()) {
+		key_count x = s.pull();
+		TEST_ENSURE_EQUALITY(key, x.key, "Wrong key");
+		TEST_ENSURE_EQUALITY(100, x.count, "Wrong count");
+		++key;
+	}
+	TEST_ENSURE_EQUALITY(10, key, "Wrong number of groups");
+	return true;
+}
+
+bool limit_test(size_t items, size_t k) {
+	const memory_size_type runLength = 1000;
+	const memory_size_type fanout = 4;
+	merge_sorter<uint64_t, false> s;
+	s.set_parameters(runLength, fanout);
+	s.set_limit(k);
+	std::vector<uint64_t> input(items);
+	std::mt19937 rng(3);
+	for (size_t i = 0; i < items; ++i) input[i] = rng();
+	s.begin();
+	for (size_t i = 0; i < items; ++i) s.push(input[i]);
+	s.end();
+	// Once enough runs are written, later items past the threshold are
+	// discarded instead of being added to a run.
+	TEST_ENSURE(s.item_count() < items, "No items were discarded");
+	dummy_progress_indicator pi;
+	s.calc(pi);
+	std::sort(input.begin(), input.end());
+	size_t read = 0;
+	while (s.can_pull()) {
+		uint64_t x = s.pull();
+		TEST_ENSURE(read < k, "Too many items");
+		TEST_ENSURE_EQUALITY(input[read], x, "Wrong item");
+		++read;
+	}
+	TEST_ENSURE_EQUALITY(k, read, "Wrong number of items");
+	return true;
+}
+
+bool cost_model_test() {
+	sort_device_speeds speeds;
+	speeds.cacheComparison = 1e-9;
+	speeds.memoryComparison = 4e-9;
+	speeds.cacheBytes = 32*1024;
+	speeds.memoryBytes = 16*1024*1024;
+	speeds.sequentialByte = 1e-8;
+	speeds.compressionByte = 2e-9;
+	speeds.blockSwitch = 1e-2;
+	speeds.blockBytes = 2*1024*1024;
+	sort_cost_model model(speeds, sizeof(uint64_t));
+
+	TEST_ENSURE(model.compress_runs(0.3), "Compressible runs not compressed");
+	TEST_ENSURE(!model.compress_runs(1.0), "Incompressible runs compressed");
+
+	TEST_ENSURE_EQUALITY(0, sort_cost_model::merge_levels(1, 16, 16), "Wrong merge levels");
+	TEST_ENSURE_EQUALITY(1, sort_cost_model::merge_levels(10, 16, 16), "Wrong merge levels");
+	TEST_ENSURE_EQUALITY(3, sort_cost_model::merge_levels(300, 16, 16), "Wrong merge levels");
+	TEST_ENSURE_EQUALITY(2, sort_cost_model::merge_levels(12, 16, 8), "Wrong merge levels");
+
+	// On a slow device, every merge level is expensive, so the model must
+	// not form shorter runs or use a smaller fanout at the cost of an extra
+	// level.
+	const stream_size_type items = 100000000;
+	const memory_size_type runLength = 1000000;
+	sort_cost_estimate e = model.choose(items, runLength, 250, 250, 1.0);
+	log_info() << "Slow device: run length " << e.runLength << ", fanout " << e.fanout
+			   << " and " << e.mergeLevels << " merge levels" << std::endl;
+	TEST_ENSURE(e.runLength <= runLength && e.fanout <= 250, "Parameters exceed the limits");
+	TEST_ENSURE_EQUALITY(1, e.mergeLevels, "An extra merge level was chosen");
+	TEST_ENSURE(!e.compressRuns, "Incompressible runs compressed");
+	e = model.choose(items, runLength, 10, 10, 1.0);
+	TEST_ENSURE_EQUALITY(sort_cost_model::merge_levels(items / runLength, 10, 10), e.mergeLevels, "Too many merge levels");
+
+	// On a fast device, sorting short runs in cache may pay for an extra
+	// level, but never at a higher predicted cost than the defaults.
+	speeds.sequentialByte = 1e-10;
+	speeds.blockSwitch = 0;
+	sort_cost_model fast(speeds, sizeof(uint64_t));
+	e = fast.choose(items, runLength, 250, 250, 1.0);
+	log_info() << "Fast device: run length " << e.runLength << ", fanout " << e.fanout
+			   << " and " << e.mergeLevels << " merge levels" << std::endl;
+	TEST_ENSURE(e.seconds <= fast.predict(items, runLength, 250, 250, false, 1.0), "Worse than the default parameters");
+	TEST_ENSURE_EQUALITY(sort_cost_model::merge_levels((items + e.runLength - 1) / e.runLength, e.fanout, e.finalFanout),
+						 e.mergeLevels, "Wrong merge levels");
+	return true;
+}
+
+bool cost_model_sort_test(size_t items) {
+	merge_sorter<uint64_t, false> s;
+	s.set_available_memory(20*1024*1024);
+	s.set_cost_model(true);
+	s.set_items(items);
+	std::mt19937_64 rng(7);
+	s.begin();
+	for (size_t i = 0; i < items; ++i) s.push(rng());
+	s.end();
+	log_info() << "Formed " << s.run_count() << " runs with run length " << s.get_parameters().runLength
+			   << " and fanout " << s.get_parameters().fanout << std::endl;
+	TEST_ENSURE(s.run_count() > 1, "Sort was not external");
+	TEST_ENSURE(!s.compresses_runs(), "Random runs compressed");
+	dummy_progress_indicator pi;
+	s.calc(pi);
+	size_t read = 0;
+	uint64_t prev = 0;
+	while (s.can_pull()) {
+		uint64_t x = s.pull();
+		TEST_ENSURE(prev <= x, "Output not sorted");
+		prev = x;
+		++read;
+	}
+	TEST_ENSURE_EQUALITY(items, read, "Wrong number of items");
+	return true;
+}
+
+// Merge runs that span several blocks, so the merger reads blocks ahead.
+bool merge_prefetch_test(size_t runs, size_t runLength) {
+	merge_sorter<uint64_t, false> s;
+	s.set_parameters(runLength, runs);
+	std::mt19937_64 rng(13);
+	s.begin();
+	for (size_t i = 0; i < runs * runLength; ++i) s.push(rng() % (runs * runLength));
+	s.end();
+	TEST_ENSURE_EQUALITY(runs, s.run_count(), "Wrong number of runs");
+	dummy_progress_indicator pi;
+	s.calc(pi);
+	size_t read = 0;
+	uint64_t prev = 0;
+	while (s.can_pull()) {
+		uint64_t x = s.pull();
+		TEST_ENSURE(prev <= x, "Output not sorted");
+		prev = x;
+		++read;
+	}
+	TEST_ENSURE_EQUALITY(runs * runLength, read, "Wrong number of items");
+	return true;
+}
+
+// Compares keys only, like key_count_less, but sorts by a key prefix.
+struct key_count_prefix_less : key_count_less {};
+
+namespace tpie {
+template <>
+struct key_prefix<key_count, key_count_prefix_less> {
+	static const bool enabled = true;
+	typedef uint32_t prefix_type;
+	static prefix_type prefix(const key_count & item) {
+		return static_cast<prefix_type>(item.key >> 4);
+	}
+};
+} // namespace tpie
+
+// Sort items with many equal keys, numbered in input order by count, and
+// check that equal keys come out in input order.
+template <typename pred_t>
+bool stable_test(size_t items, size_t keys) {
+	const memory_size_type runLength = 1000;
+	const memory_size_type fanout = 4;
+	merge_sorter<key_count, false, pred_t> s;
+	s.set_parameters(runLength, fanout);
+	s.set_stable(true);
+	s.begin();
+	std::mt19937 rng(11);
+	for (size_t i = 0; i < items; ++i) {
+		key_count x = {rng() % keys, i};
+		s.push(x);
+	}
+	s.end();
+	dummy_progress_indicator pi;
+	s.calc(pi);
+	size_t read = 0;
+	key_count prev = {0, 0};
+	while (s.can_pull()) {
+		key_count x = s.pull();
+		TEST_ENSURE(read == 0 || prev.key <= x.key, "Out of order");
+		TEST_ENSURE(read == 0 || prev.key < x.key || prev.count < x.count, "Equal keys reordered");
+		prev = x;
+		++read;
+	}
+	TEST_ENSURE_EQUALITY(items, read, "Wrong number of items");
+	return true;
+}
+
 int main(int argc, char ** argv) {
 	tests t(argc, argv);
 	return
@@ -166,5 +550,20 @@ int main(int argc, char ** argv) {
 		.test(sort_faulty_upper_bound_test, "sort_faulty_upper_bound")
 		.test(temp_file_usage_test, "temp_file_usage")
 		.test(tall_tree_test, "tall_tree", "fanout", static_cast<size_t>(6), "height", static_cast<size_t>(1))
+		.test(replacement_selection_sorted_input_test, "replacement_selection_presorted", "ascending", true)
+		.test(replacement_selection_sorted_input_test, "replacement_selection_descending", "ascending", false)
+		.test(sorted_segments_test, "presorted", "segments", static_cast<size_t>(1), "aligned", true)
+		.test(sorted_segments_test, "sorted_segments", "segments", static_cast<size_t>(3), "aligned", true)
+		.test(sorted_segments_test, "unaligned_sorted_segments", "segments", static_cast<size_t>(3), "aligned", false)
+		.test(key_prefix_test, "key_prefix_internal", "items", static_cast<size_t>(800))
+		.test(key_prefix_test, "key_prefix", "items", static_cast<size_t>(50000))
+		.test(combine_test, "combine", "keys", static_cast<size_t>(2000), "duplicates", static_cast<size_t>(100))
+		.test(combine_internal_test, "combine_internal")
+		.test(limit_test, "limit", "items", static_cast<size_t>(100000), "k", static_cast<size_t>(2500))
+		.test(cost_model_test, "cost_model")
+		.test(cost_model_sort_test, "cost_model_sort", "items", static_cast<size_t>(4000000))
+		.test(merge_prefetch_test, "merge_prefetch", "runs", static_cast<size_t>(8), "runlength", static_cast<size_t>(600000))
+		.test(stable_test<key_count_less>, "stable", "items", static_cast<size_t>(100000), "keys", static_cast<size_t>(100))
+		.test(stable_test<key_count_prefix_less>, "stable_key_prefix", "items", static_cast<size_t>(100000), "keys", static_cast<size_t>(100))
 		;
 }
@@ -201,6 +201,52 @@ bool stress_test() {
 	return false;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// Progress indicator that checks that the sort reports progress within the
+/// range it initialized.
+///////////////////////////////////////////////////////////////////////////////
+struct checking_progress : public progress_indicator_base {
+	checking_progress() : progress_indicator_base(0), inits(0), dones(0) {}
+
+	virtual void init(stream_size_type range) override {
+		progress_indicator_base::init(range);
+		++inits;
+	}
+
+	virtual void done() override {
+		++dones;
+	}
+
+	virtual void refresh() override {}
+
+	size_t inits;
+	size_t dones;
+};
+
+bool sample_sort_test(size_t n, size_t workers) {
+	std::mt19937 prng(42);
+	for (size_t distinct = 1; distinct <= n; distinct *= 16) {
+		std::vector<int> v1(n);
+		for (size_t i = 0; i < n; ++i) v1[i] = static_cast<int>(prng() % distinct);
+		std::vector<int> v2(v1);
+		std::sort(v1.begin(), v1.end());
+		checking_progress pi;
+		parallel_sort_impl<std::vector<int>::iterator, std::less<int>, true, 64> s(&pi);
+		s.set_worker_count(workers);
+		s(v2.begin(), v2.end());
+		if (v1 != v2) {
+			tpie::log_error() << "Wrong result with " << distinct << " distinct items" << std::endl;
+			return false;
+		}
+		TEST_ENSURE(pi.inits == 1, "Progress indicator not initialized once");
+		TEST_ENSURE(pi.dones == 1, "Progress indicator not done once");
+		TEST_ENSURE(pi.get_range() > 0, "Empty progress range");
+		TEST_ENSURE(pi.get_current() <= pi.get_range(), "Progress exceeds range");
+		TEST_ENSURE(pi.get_current() > 0, "No progress reported");
+	}
+	return true;
+}
+
 template <size_t fields>
 struct padded_item {
 	padded_item<fields-1> rest;
@@ -304,6 +350,7 @@ int main(int argc, char **argv) {
 #endif
 		.test(adversarial<make_equal_elements_data>(), "equal_elements", "n", 1234567, "seconds", 1.0)
 		.test(bad_case, "bad_case", "n", 1024*1024, "seconds", 1.0)
+		.test(sample_sort_test, "sample_sort", "n", 100000, "workers", static_cast<size_t>(8))
 		.test(adversarial<make_random_data>(), "general2", "n", 1024*1024, "seconds", 1.0)
 		.test(stress_test, "stress_test")
 		.test(large_item_test_chooser, "large_item", "mb", static_cast<size_t>(2048), "item-size", static_cast<size_t>(32))
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <cmath>
 #include <memory>
+#include <random>
 #include <tpie/sysinfo.h>
 #include <tpie/pipelining/forwarder.h>
 #include <tpie/pipelining/virtual.h>
@@ -434,6 +435,101 @@ bool sort_test_large() {
 	return sort_test(300*1024);
 }
 
+bool combining_sort_test() {
+	inputvector.resize(0);
+	expectvector.resize(0);
+	for (test_t i = 0; i < 1000; ++i) inputvector.push_back(i % 7);
+	for (test_t i = 0; i < 7; ++i) expectvector.push_back(i);
+	struct first { test_t operator()(test_t a, test_t) const { return a; } };
+	pipeline p = input_vector(inputvector)
+		| combining_sort(std::less<test_t>(), first())
+		| output_vector(outputvector);
+	p();
+	return check_test_vectors();
+}
+
+bool partial_sort_test(size_t n, size_t k, memory_size_type memory) {
+	inputvector.resize(n);
+	std::mt19937 rng(17);
+	for (size_t i = 0; i < n; ++i) inputvector[i] = rng() % (n / 2 + 1);
+	expectvector = inputvector;
+	std::sort(expectvector.begin(), expectvector.end());
+	expectvector.resize(std::min(n, k));
+	outputvector.resize(0);
+	pipeline p = input_vector(inputvector)
+		| partial_sort(k)
+		| output_vector(outputvector);
+	progress_indicator_null pi;
+	p(n, pi, memory, TPIE_FSI);
+	return check_test_vectors();
+}
+
+bool partial_sort_heap_test() {
+	// k items fit in memory.
+	return partial_sort_test(100000, 100, 50*1024*1024);
+}
+
+bool partial_sort_external_test() {
+	// k items do not fit in memory.
+	return partial_sort_test(4000000, 2000000, 12*1024*1024);
+}
+
+bool stable_sort_test() {
+	typedef std::pair<uint64_t, uint64_t> item_t;
+	struct first_less {
+		bool operator()(const item_t & a, const item_t & b) const {
+			return a.first < b.first;
+		}
+	};
+	const size_t n = 2000000;
+	std::vector<item_t> input(n);
+	std::mt19937 rng(31);
+	for (size_t i = 0; i < n; ++i) input[i] = item_t(rng() % 1000, i);
+	std::vector<item_t> expect = input;
+	std::stable_sort(expect.begin(), expect.end(), first_less());
+	std::vector<item_t> output;
+	pipeline p = input_vector(input)
+		| stable_sort(first_less())
+		| output_vector(output);
+	progress_indicator_null pi;
+	p(n, pi, 12*1024*1024, TPIE_FSI);
+	TEST_ENSURE(output == expect, "Equal items reordered");
+	return true;
+}
+
+// skew is the fraction of items that are equal to the same key; the rest
+// are uniformly random.
+bool distribution_sort_test(size_t n, memory_size_type memory, double skew) {
+	inputvector.resize(n);
+	std::mt19937_64 rng(23);
+	std::uniform_real_distribution<double> coin(0.0, 1.0);
+	for (size_t i = 0; i < n; ++i)
+		inputvector[i] = coin(rng) < skew ? 42 : rng();
+	expectvector = inputvector;
+	std::sort(expectvector.begin(), expectvector.end());
+	outputvector.resize(0);
+	pipeline p = input_vector(inputvector)
+		| distribution_sort()
+		| output_vector(outputvector);
+	progress_indicator_null pi;
+	p(n, pi, memory, TPIE_FSI);
+	return check_test_vectors();
+}
+
+bool distribution_sort_internal_test() {
+	return distribution_sort_test(100000, 50*1024*1024, 0.0);
+}
+
+bool distribution_sort_external_test() {
+	return distribution_sort_test(4000000, 12*1024*1024, 0.0);
+}
+
+bool distribution_sort_skewed_test() {
+	// Most items go to one bucket, which is distributed again and finally
+	// merge sorted since its items are equal.
+	return distribution_sort_test(4000000, 12*1024*1024, 0.8);
+}
+
 // This tests that pipe_middle | pipe_middle -> pipe_middle,
 // and that pipe_middle | pipe_end -> pipe_end.
 // The other tests already test that pipe_begin | pipe_middle -> pipe_middle,
@@ -2636,6 +2732,13 @@ int main(int argc, char ** argv) {
 	.test(sort_test_trivial, "sorttrivial")
 	.test(sort_test_small, "sort")
 	.test(sort_test_large, "sortbig")
+	.test(combining_sort_test, "combining_sort")
+	.test(partial_sort_heap_test, "partial_sort")
+	.test(partial_sort_external_test, "partial_sort_external")
+	.test(stable_sort_test, "stable_sort")
+	.test(distribution_sort_internal_test, "distribution_sort")
+	.test(distribution_sort_external_test, "distribution_sort_external")
+	.test(distribution_sort_skewed_test, "distribution_sort_skewed")
 	.test(operator_test, "operators")
 	.test(uniq_test, "uniq")
 	.multi_test(memory_test_multi, "memory")
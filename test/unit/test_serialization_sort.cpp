@@ -67,9 +67,135 @@ public:
 	};
 };
 
+// Strings sharing long prefixes, including zero and high bytes, to exercise
+// the multikey quicksort and the LCP-aware merger.
+static std::vector<std::string> generate_strings(size_t items) {
+	const std::string prefixes[] = {
+		"", "http://www.example.com/", "http://www.example.com/index/",
+		"https://www.example.org/", std::string("a\0\0\0\0\0\0\0b", 10)
+	};
+	const char alphabet[] = {'a', 'b', 'z', '\0', '\x7f', '\xff'};
+	std::mt19937 rng(items);
+	std::vector<std::string> res(items);
+	for (size_t i = 0; i < items; ++i) {
+		res[i] = prefixes[rng() % 5];
+		size_t length = rng() % 24;
+		for (size_t j = 0; j < length; ++j) res[i] += alphabet[rng() % 6];
+	}
+	return res;
+}
+
+static bool string_sort_test(size_t items, bool external, size_t mergeWorkers = 1,
+							 size_t runFormationWorkers = 0) {
+	std::vector<std::string> input = generate_strings(items);
+	std::vector<std::string> expected = input;
+	std::sort(expected.begin(), expected.end());
+
+	serialization_sorter<std::string> s;
+	if (external) {
+		memory_size_type m1 = runFormationWorkers ? 20*1024*1024 : 3*1024*1024;
+		s.set_available_memory(m1, 10*mergeWorkers*1024*1024, 10*1024*1024);
+		s.set_available_files(1, 4*mergeWorkers, 4);
+		s.set_merge_workers(mergeWorkers);
+		s.set_run_formation_workers(runFormationWorkers);
+	} else {
+		s.set_available_memory(50*1024*1024);
+	}
+	s.begin();
+	for (size_t i = 0; i < items; ++i) s.push(input[i]);
+	s.end();
+	s.merge_runs();
+
+	if (external && s.run_count() <= 3) {
+		log_error() << "Expected more runs than the final fanout, got " << s.run_count() << std::endl;
+		return false;
+	}
+	TEST_ENSURE(s.concurrent_merges() <= mergeWorkers, "Too many concurrent merges");
+	TEST_ENSURE(mergeWorkers == 1 || s.concurrent_merges() > 1, "Expected concurrent merges");
+
+	for (size_t i = 0; i < items; ++i) {
+		if (!s.can_pull()) {
+			log_error() << "Sorter ran out of items after " << i << std::endl;
+			return false;
+		}
+		std::string item = s.pull();
+		if (item != expected[i]) {
+			log_error() << "Wrong item at position " << i << std::endl;
+			return false;
+		}
+	}
+	TEST_ENSURE(!s.can_pull(), "Sorter reported too many items");
+	return true;
+}
+
+static bool string_sort_internal_test(size_t items) {
+	return string_sort_test(items, false);
+}
+
+static bool string_sort_external_test(size_t items) {
+	return string_sort_test(items, true);
+}
+
+static bool string_sort_concurrent_merge_test(size_t items) {
+	return string_sort_test(items, true, 4);
+}
+
+static bool string_sort_parallel_run_formation_test(size_t items) {
+	return string_sort_test(items, true, 1, 3);
+}
+
+static bool check_sorted_output(use_serialization_sorter::sorter & s, stream_size_type items) {
+	use_serialization_sorter::test_t prev;
+	stream_size_type pulled = 0;
+	while (s.can_pull()) {
+		use_serialization_sorter::test_t item = s.pull();
+		TEST_ENSURE(pulled == 0 || !(item < prev), "Items out of order");
+		prev.swap(item);
+		++pulled;
+	}
+	TEST_ENSURE_EQUALITY(items, pulled, "Wrong number of items");
+	return true;
+}
+
+// Merge groups of runs of vectors concurrently with the loser tree merger.
+static bool concurrent_merge_test(double mb) {
+	use_serialization_sorter::item_generator gen(static_cast<stream_size_type>(mb * 1024 * 1024));
+	use_serialization_sorter::sorter s;
+	s.set_available_memory(3*1024*1024, 40*1024*1024, 20*1024*1024);
+	s.set_available_files(1, 32, 8);
+	s.set_merge_workers(2);
+	s.begin();
+	for (stream_size_type i = 0; i < gen.items(); ++i) s.push(gen());
+	s.end();
+	s.merge_runs();
+	TEST_ENSURE(s.run_count() > 7, "Expected more runs than the final fanout");
+	TEST_ENSURE_EQUALITY(2, s.concurrent_merges(), "Wrong number of concurrent merges");
+	return check_sorted_output(s, gen.items());
+}
+
+// Form runs of vectors in two buffers, serializing in slices on job threads.
+static bool parallel_run_formation_test(double mb) {
+	use_serialization_sorter::item_generator gen(static_cast<stream_size_type>(mb * 1024 * 1024));
+	use_serialization_sorter::sorter s;
+	s.set_available_memory(20*1024*1024, 20*1024*1024, 20*1024*1024);
+	s.set_run_formation_workers(3);
+	s.begin();
+	for (stream_size_type i = 0; i < gen.items(); ++i) s.push(gen());
+	s.end();
+	s.merge_runs();
+	TEST_ENSURE(s.run_count() > 2, "Expected several runs");
+	return check_sorted_output(s, gen.items());
+}
+
 int main(int argc, char ** argv) {
 	tests t(argc, argv);
 	sort_tester<use_serialization_sorter>::add_all(t);
 	sort_tester<use_serialization_sorter>::add_file_limit_test(t, 3);
+	t.test(string_sort_internal_test, "string_sort_internal", "items", 100000);
+	t.test(string_sort_external_test, "string_sort", "items", 200000);
+	t.test(string_sort_concurrent_merge_test, "string_sort_concurrent_merge", "items", 200000);
+	t.test(concurrent_merge_test, "concurrent_merge", "mb", 20.0);
+	t.test(string_sort_parallel_run_formation_test, "string_sort_parallel_run_formation", "items", 600000);
+	t.test(parallel_run_formation_test, "parallel_run_formation", "mb", 30.0);
 	return t;
 }
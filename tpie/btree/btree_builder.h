@@ -251,6 +251,11 @@ public:
 		}
     }
 	
+	/**
+	* \brief The comparator that pushed values are expected to be ordered by
+	*/
+	const comp_type & comparator() const {return m_comp;}
+
 	/**
 	* \brief Constructs and returns a btree from the value that was pushed to the builder. The btree builder should not be used again after this point.
 	*/
@@ -28,7 +28,10 @@ public:
 
 	const static memory_size_type EXTRA_BUFFERS = 2;
 
-	impl() {
+	impl()
+		: m_sharedBuffers(EXTRA_BUFFERS)
+		, m_targetSharedBuffers(EXTRA_BUFFERS)
+	{
 		m_extraBuffers.reserve(EXTRA_BUFFERS);
 		for (size_t i = 0; i < EXTRA_BUFFERS; ++i) {
 			m_extraBuffers.push_back(std::make_shared<compressor_buffer>(block_size()));
@@ -61,18 +64,45 @@ public:
 
 	void release_shared_buffer(buffer_t & b) {
 		tp_assert(b.unique(), "release_shared_buffer: !b.unique");
-		tp_assert(!(m_extraBuffers.size() == EXTRA_BUFFERS), "release_shared_buffer: Too many available shared buffers");
+		tp_assert(!(m_extraBuffers.size() == m_sharedBuffers), "release_shared_buffer: Too many available shared buffers");
 
+		if (m_sharedBuffers > m_targetSharedBuffers) {
+			// The buffer was removed while it was taken.
+			--m_sharedBuffers;
+			buffer_t().swap(b);
+			return;
+		}
 		m_extraBuffers.push_back(buffer_t());
 		m_extraBuffers.back().swap(b);
 	}
 
+	void add_shared_buffers(memory_size_type count) {
+		m_targetSharedBuffers += count;
+		while (m_sharedBuffers < m_targetSharedBuffers) {
+			m_extraBuffers.push_back(std::make_shared<compressor_buffer>(block_size()));
+			++m_sharedBuffers;
+		}
+	}
+
+	void remove_shared_buffers(memory_size_type count) {
+		tp_assert(m_targetSharedBuffers >= EXTRA_BUFFERS + count, "remove_shared_buffers: Too many buffers removed");
+		m_targetSharedBuffers -= count;
+		while (m_sharedBuffers > m_targetSharedBuffers && !m_extraBuffers.empty()) {
+			m_extraBuffers.pop_back();
+			--m_sharedBuffers;
+		}
+	}
+
 private:
 	memory_size_type block_size() {
 		return compressed_stream_base::block_size(1.0);
 	}
 
 	std::vector<buffer_t> m_extraBuffers;
+	/** Number of shared buffers, both available and taken. */
+	memory_size_type m_sharedBuffers;
+	/** Number of shared buffers that should exist. */
+	memory_size_type m_targetSharedBuffers;
 };
 
 stream_buffer_pool::stream_buffer_pool()
@@ -104,6 +134,14 @@ void stream_buffer_pool::release_shared_buffer(buffer_t & b) {
 	pimpl->release_shared_buffer(b);
 }
 
+void stream_buffer_pool::add_shared_buffers(memory_size_type count) {
+	pimpl->add_shared_buffers(count);
+}
+
+void stream_buffer_pool::remove_shared_buffers(memory_size_type count) {
+	pimpl->remove_shared_buffers(count);
+}
+
 } // namespace tpie
 
 namespace {
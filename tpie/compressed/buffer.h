@@ -203,7 +203,9 @@ public:
 ///
 /// In addition, on program startup we allocate a number of shared buffers
 /// on program startup which any stream may use for additional efficiency.
-/// Currently, we allocate two such shared buffers.
+/// Currently, we allocate two such shared buffers. More shared buffers may
+/// be added for a while with \c add_shared_buffers, for instance to let a
+/// merge read blocks ahead.
 ///
 /// The stream_buffer_pool class is responsible for allocating and deallocating
 /// both the streams' own buffers and the shared buffers.
@@ -225,6 +227,18 @@ public:
 	buffer_t take_shared_buffer();
 	void release_shared_buffer(buffer_t &);
 
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief  Allocate the given number of additional shared buffers.
+	///////////////////////////////////////////////////////////////////////////
+	void add_shared_buffers(memory_size_type count);
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief  Deallocate the given number of shared buffers previously
+	/// added with \c add_shared_buffers. Buffers that are taken by a stream
+	/// are deallocated when they are released.
+	///////////////////////////////////////////////////////////////////////////
+	void remove_shared_buffers(memory_size_type count);
+
 private:
 	class impl;
 	impl * pimpl;
@@ -338,6 +352,22 @@ public:
 		}
 	}
 
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief  Like \c get_buffer, but return an empty pointer instead of
+	/// waiting when there is no free buffer for the given block.
+	///////////////////////////////////////////////////////////////////////////
+	buffer_t try_get_buffer(compressor_thread_lock & lock, stream_size_type blockNumber) {
+		buffermapit target = m_buffers.find(blockNumber);
+		if (target != m_buffers.end()) return target->second;
+		if (m_ownBuffers < OWN_BUFFERS || can_take_shared_buffer())
+			return get_buffer(lock, blockNumber);
+		for (buffermapit i = m_buffers.begin(); i != m_buffers.end(); ++i) {
+			// get_buffer reuses a free buffer without waiting.
+			if (i->second.unique()) return get_buffer(lock, blockNumber);
+		}
+		return buffer_t();
+	}
+
 	bool empty() const {
 		return m_buffers.empty();
 	}
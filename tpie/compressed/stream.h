@@ -336,6 +336,43 @@ public:
 	bool can_read_back() {
 		return offset() > 0;
 	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief  The number of items that can be read before the stream has
+	/// to read another block.
+	///////////////////////////////////////////////////////////////////////////
+	memory_size_type buffered_items() const;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief  Start reading the block after the current one in the
+	/// background, so that reading past the current block does not have to
+	/// wait for I/O.
+	///
+	/// The block is read into a shared stream buffer. A stream reads at most
+	/// one block ahead.
+	///
+	/// Blocks to take the compressor lock.
+	///
+	/// \returns  Whether the next block is being read or is in memory.
+	/// False if there is no free shared buffer, or if the stream is not
+	/// reading forwards in a block that is followed by another block.
+	///////////////////////////////////////////////////////////////////////////
+	bool prefetch_next_block();
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief  Add the given number of buffers to the buffers shared by all
+	/// streams, which prefetch_next_block reads into.
+	///
+	/// Blocks to take the compressor lock.
+	///////////////////////////////////////////////////////////////////////////
+	static void add_prefetch_buffers(memory_size_type count);
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief  Remove buffers added with add_prefetch_buffers.
+	///
+	/// Blocks to take the compressor lock.
+	///////////////////////////////////////////////////////////////////////////
+	static void remove_prefetch_buffers(memory_size_type count);
 protected:
 	/** Number of cheap, unchecked reads we can do next. */
 	memory_size_type m_cachedReads;
@@ -453,6 +490,17 @@ public:
 		return *reinterpret_cast<const T*>(m_nextItem);
 	}
 
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief  The last item that can be read before the stream has to read
+	/// another block.
+	///
+	/// Precondition: buffered_items() > 0
+	///////////////////////////////////////////////////////////////////////////
+	const T & last_buffered_item() const {
+		tp_assert(buffered_items() > 0, "last_buffered_item: No buffered items");
+		return *reinterpret_cast<const T*>(m_nextItem + (buffered_items() - 1) * sizeof(T));
+	}
+
 	void skip() {
 		read();
 	}
@@ -137,6 +137,11 @@ public:
 	stream_buffers m_buffers;
 	/** Buffer holding the items of the block currently being read/written. */
 	buffer_t m_buffer;
+	/** Buffer of the block read ahead by prefetch_next_block, if any. */
+	buffer_t m_prefetchBuffer;
+	stream_size_type m_prefetchBlockNumber;
+	/** Response from compressor thread to the read ahead. */
+	compressor_response m_prefetchResponse;
 
 	/** The number of blocks written to the file.
 	 * We must always have (m_streamBlocks+1) * m_blockItems <= m_size. */
@@ -188,6 +193,8 @@ public:
 		, m_byteStreamAccessor()
 		, m_buffers(m_blockSize)
 		, m_buffer(/* empty shared_ptr */)
+		, m_prefetchBuffer(/* empty shared_ptr */)
+		, m_prefetchBlockNumber(0)
 		, m_streamBlocks(0)
 		, m_lastBlockReadOffset(0)
 		, m_currentFileSize(0)
@@ -363,6 +370,7 @@ public:
 
 	void finish_requests(compressor_thread_lock & l) {
 		tp_assert(!(m_buffer.get() != 0), "finish_requests called when own buffer is still held");
+		m_prefetchBuffer.reset();
 		m_buffers.clean();
 		while (!m_buffers.empty()) {
 			compressor().wait_for_request_done(l);
@@ -497,7 +505,17 @@ public:
 	void get_buffer(compressor_thread_lock & l, stream_size_type blockNumber) {
 		uncache_read_writes();
 		buffer_t().swap(m_buffer);
+		// Let get_buffer reuse a read ahead buffer that we do not need.
+		if (m_prefetchBuffer.get() != 0 && m_prefetchBlockNumber != blockNumber)
+			m_prefetchBuffer.reset();
 		m_buffer = this->m_buffers.get_buffer(l, blockNumber);
+		if (m_prefetchBuffer.get() != 0) {
+			// The block was read ahead into a shared buffer. Return the buffer
+			// of the previous block to the pool, so other streams can read
+			// ahead.
+			m_prefetchBuffer.reset();
+			m_buffers.clean();
+		}
 		while (m_buffer->is_busy()) compressor().wait_for_request_done(l);
 		m_o->m_bufferBegin = m_buffer->get();
 		m_o->m_bufferEnd = m_o->m_bufferBegin + m_itemSize * m_blockItems;
@@ -581,6 +599,50 @@ public:
 		m_o->m_nextItem = m_o->m_bufferBegin;
 	}
 
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief  Start reading the block after the current one into a free
+	/// buffer without waiting for it.
+	///
+	/// A buffer for the block in m_buffers is in the dirty state until it has
+	/// been read, and then it is clean, so read_next_block uses it as is.
+	///////////////////////////////////////////////////////////////////////////
+	bool prefetch_next_block() {
+		if (!m_open || !m_canRead
+			|| m_o->m_seekState != compressed_stream_base::seek_state::none
+			|| m_buffer.get() == 0 || m_bufferDirty || m_updateReadOffsetFromWrite)
+			return false;
+		stream_size_type blockNumber = buffer_block_number() + 1;
+		if (m_prefetchBuffer.get() != 0) return m_prefetchBlockNumber == blockNumber;
+		if (blockNumber >= m_streamBlocks) return false;
+
+		compressor_thread_lock l(compressor());
+		buffer_t b = m_buffers.try_get_buffer(l, blockNumber);
+		if (b.get() == 0) return false;
+		m_prefetchBuffer = b;
+		m_prefetchBlockNumber = blockNumber;
+		if (b->get_state() != compressor_buffer_state::dirty) return true;
+
+		stream_size_type readOffset;
+		if (use_compression()) {
+			readOffset = m_nextReadOffset;
+		} else {
+			stream_size_type itemOffset = blockNumber * m_blockItems;
+			readOffset = blockNumber * m_blockSize;
+			b->set_size(std::min(m_blockSize,
+								 static_cast<memory_size_type>((m_o->size() - itemOffset) * m_itemSize)));
+			// read_next_block takes the read offset of a clean buffer,
+			// which is zero for uncompressed streams.
+			b->set_read_offset(0);
+		}
+		compressor_request r;
+		r.set_read_request(b, &m_byteStreamAccessor, readOffset,
+						   read_direction::forward, &m_prefetchResponse);
+		b->transition_state(compressor_buffer_state::dirty,
+							compressor_buffer_state::reading);
+		compressor().request(r);
+		return true;
+	}
+
 	void read_previous_block(compressor_thread_lock & lock, stream_size_type blockNumber) {
 		uncache_read_writes();
 		tp_assert(use_compression(), "read_previous_block: !use_compression");
@@ -881,6 +943,29 @@ void compressed_stream_base::close() {
 
 
 
+memory_size_type compressed_stream_base::buffered_items() const {
+	if (m_p->m_buffer.get() == 0 || m_seekState != seek_state::none || offset() == size())
+		return 0;
+	memory_size_type items = (m_bufferEnd - m_nextItem) / m_p->m_itemSize;
+	if (offset() + items > size())
+		items = static_cast<memory_size_type>(size() - offset());
+	return items;
+}
+
+bool compressed_stream_base::prefetch_next_block() {
+	return m_p->prefetch_next_block();
+}
+
+void compressed_stream_base::add_prefetch_buffers(memory_size_type count) {
+	compressor_thread_lock l(the_compressor_thread());
+	the_stream_buffer_pool().add_shared_buffers(count);
+}
+
+void compressed_stream_base::remove_prefetch_buffers(memory_size_type count) {
+	compressor_thread_lock l(the_compressor_thread());
+	the_stream_buffer_pool().remove_shared_buffers(count);
+}
+
 void compressed_stream_base::cache_read_writes() {
 	if (m_p->m_buffer.get() == 0 || m_seekState != seek_state::none) {
 		m_cachedWrites = 0;
@@ -240,7 +240,7 @@ execution_time_predictor::~execution_time_predictor() {
 }
 
 time_type execution_time_predictor::estimate_execution_time(stream_size_type n, double & confidence) {
-	if (m_id == std::hash<std::string>()("")) {
+	if (m_id == std::hash<std::string>()("") || !db) {
 		confidence=0.0;
 		return -1;
 	}
@@ -260,7 +260,7 @@ void execution_time_predictor::start_execution(stream_size_type n) {
 }
 
 time_type execution_time_predictor::end_execution() {
-	if (m_id == std::hash<std::string>()("") || !s_store_times || std::uncaught_exceptions()) return 0;
+	if (m_id == std::hash<std::string>()("") || !db || !s_store_times || std::uncaught_exceptions()) return 0;
 	time_type t = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_start_time).count();
 	t -= (s_pause_time - m_pause_time_at_start);
 	entry & e = db->db[m_id];
@@ -186,6 +186,12 @@ public:
 	/// \param s New size of priority queue.
 	///////////////////////////////////////////////////////////////////////////
 	void resize(size_t s) {sz=0; pq.resize(s);}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief The comparator used to order the elements. It must not be
+	/// changed in a way that affects the order of elements in the queue.
+	///////////////////////////////////////////////////////////////////////////
+	comp_t & get_comparator() {return comp.i;}
 private:	
 	tpie::array<T> pq; 
     size_type sz;
@@ -19,7 +19,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 /// \file parallel_sort.h
-/// Simple parallel quick sort implementation with progress tracking.
+/// Parallel in-place sample sort implementation with progress tracking.
 ///////////////////////////////////////////////////////////////////////////////
 
 #ifndef __TPIE_PARALLEL_SORT_H__
@@ -27,6 +27,12 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+#include <condition_variable>
 #include <boost/iterator/iterator_traits.hpp>
 #include <mutex>
 #include <cmath>
@@ -36,16 +42,37 @@
 #include <tpie/internal_queue.h>
 #include <tpie/job.h>
 #include <tpie/config.h>
+#include <tpie/tpie_assert.h>
 
 namespace tpie {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief A simple parallel sort implementation with progress tracking.
-/// The partition step is sequential, as a parallel partition only speeds up
-/// the top layer, which does not warrant the hassle of implementation.
+/// \brief A parallel in-place sample sort implementation with progress
+/// tracking.
+///
+/// Splitters are drawn from a random sample of the input, and the input is
+/// distributed into the buckets they define in a single parallel pass that
+/// consists of three steps:
+///
+/// 1. Classification. The input is cut into stripes, one per worker. Each
+///    worker classifies the items of its stripe into small per-bucket
+///    buffers, and writes every full buffer back to the front of its stripe
+///    as a block.
+/// 2. Block permutation. Each block is moved to the block-aligned part of
+///    the area of its bucket. The permutation is split into independent
+///    cycles and paths, which are divided evenly among the workers.
+/// 3. Cleanup. The items left in the buffers, and the items of blocks that
+///    stick out of the area of their bucket, are moved to the unaligned
+///    ends of the bucket areas.
+///
+/// Every splitter also gets an equality bucket, whose items need no further
+/// sorting. Buckets that are still too large for a single worker are
+/// distributed again, and the rest are sorted independently using
+/// std::sort. Apart from the sample and the block buffers, no extra memory
+/// proportional to the input size is needed.
+///
 /// Uses the TPIE job manager to transparently distribute work across the
 /// machine cores.
-/// Uses the pseudo median of nine as pivot.
 ///////////////////////////////////////////////////////////////////////////////
 template <typename iterator_type, typename comp_type, bool Progress,
 		  size_t min_size=1024*1024*8/sizeof(typename boost::iterator_value<iterator_type>::type)>
@@ -60,6 +87,7 @@ private:
 		typename P::base * pi;
 		std::uint64_t work_estimate;
 		std::uint64_t total_work_estimate;
+		size_t jobs_left;
 		std::condition_variable cond;
 		std::mutex mutex;
 	};
@@ -67,6 +95,23 @@ private:
 	/** \brief The type of the values we sort. */
 	typedef typename boost::iterator_value<iterator_type>::type value_type;
 
+	/** \brief Number of sampled items per splitter. */
+	static constexpr size_t oversampling = 16;
+
+	/** \brief Maximum number of splitters used in a single distribution. */
+	static constexpr size_t max_splitters = 127;
+
+	/** \brief Number of items in a block. */
+	static constexpr size_t block_size = sizeof(value_type) >= 4096 ? 1 : 4096 / sizeof(value_type);
+
+	/** \brief Bucket number of a block slot that holds no block. */
+	static constexpr std::uint16_t empty_slot = std::numeric_limits<std::uint16_t>::max();
+
+	/** \brief Destinations of block slots that are not moved to another slot. */
+	static constexpr size_t no_block = std::numeric_limits<size_t>::max();
+	static constexpr size_t stays = no_block - 1;
+	static constexpr size_t spills = no_block - 2;
+
 	///////////////////////////////////////////////////////////////////////////
 	/// \brief Guesstimate how much work a sort uses.
 	///////////////////////////////////////////////////////////////////////////
@@ -79,167 +124,269 @@ private:
 	}
 
 	///////////////////////////////////////////////////////////////////////////
-	/// \brief Partition using *first as pivot.
-	/// \param first Iterator to left boundary.
-	/// \param last Iterator to right boundary.
-	/// \param comp Comparator.
+	/// \brief A range of items that is not yet sorted.
 	///////////////////////////////////////////////////////////////////////////
-	template <typename comp_t>
-	static inline iterator_type unguarded_partition(iterator_type first, 
-													iterator_type last, 
-													comp_t & comp) {
-		// Textbook partitioning.
-		iterator_type pivot = first;
-		while (true) {
-			do --last;
-			while (comp(*pivot, *last));
-
-			do {
-				if (first == last) break;
-				++first;
-			} while (comp(*first, *pivot));
+	struct bucket {
+		iterator_type a;
+		iterator_type b;
+	};
 
-			if (first == last) break;
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Assigns items to the buckets defined by a sorted sequence of
+	/// distinct splitters. Bucket 2i holds the items between splitter i-1 and
+	/// splitter i, and bucket 2i+1 holds the items equal to splitter i.
+	///////////////////////////////////////////////////////////////////////////
+	struct classifier {
+		comp_type comp;
+		const value_type * first;
+		const value_type * last;
 
-			std::iter_swap(first, last);
+		size_t buckets() const {
+			return 2 * static_cast<size_t>(last - first) + 1;
 		}
-		std::iter_swap(last, pivot);
-		return last;
-	}
 
-	///////////////////////////////////////////////////////////////////////////
-	/// \brief Median of three.
-	/// \param a Iterator to an element.
-	/// \param b Iterator to an element.
-	/// \param c Iterator to an element.
-	/// \param comp Comparator.
-	///////////////////////////////////////////////////////////////////////////
-	static inline iterator_type median(iterator_type a, iterator_type b, iterator_type c, comp_type & comp) {
-		if (comp(*a, *b)) {
-			if (comp(*b, *c)) return b;
-			else if (comp(*a, *c)) return c;
-			else return a;
-		} else {
-			if (comp(*a, *c)) return a;
-			else if (comp(*b, *c)) return c;
-			else return b;
+		size_t operator()(const value_type & x) {
+			const value_type * i = std::upper_bound(first, last, x, comp);
+			const size_t below = static_cast<size_t>(i - first);
+			if (below > 0 && !comp(*(i - 1), x)) return 2 * below - 1;
+			return 2 * below;
 		}
-	}
+	};
 
 	///////////////////////////////////////////////////////////////////////////
-	/// \brief Pseudo-median of nine.
-	/// It uses the boundary elements as well as the seven 0.125-fractiles
-	/// to find a good element for partitioning.
-	/// \param a Iterator to left boundary.
-	/// \param b Iterator to right boundary.
-	/// \param comp Comparator.
+	/// \brief A stripe of a distribution, classified by a single worker.
 	///////////////////////////////////////////////////////////////////////////
-	static inline iterator_type pick_pivot(iterator_type a, iterator_type b, comp_type & comp) {
-		if (a == b) return a;
-		assert(a < b);
-
-		// Since (b-a) is at least min_size, which is at least 100000 in
-		// realistic contexts, ((b-a)/8)*c is a good approximation of
-		// (c*(b-a))/8.
-		size_t step = (b-a)/8;
-
-		return median(median(a+0, a+step, a+step*2, comp),
-					  median(a+step*3, a+step*4, a+step*5, comp),
-					  median(a+step*6, a+step*7, b-1, comp), comp);
-	}
+	struct stripe {
+		iterator_type a;
+		iterator_type b;
+		/** Bucket of each block written to the front of the stripe. */
+		std::vector<std::uint16_t> blocks;
+		/** Items of each bucket that did not fill a block. */
+		std::vector<std::vector<value_type> > buffers;
+	};
 
 	///////////////////////////////////////////////////////////////////////////
-	/// \brief Partition using pivot returned by pick_pivot.
-	/// \param a Iterator to left boundary.
-	/// \param b Iterator to right boundary.
-	/// \param comp Comparator.
+	/// \brief State of the distribution of a bucket into smaller buckets.
+	///
+	/// Offsets and slot numbers are relative to the start of the range.
+	/// Slot q is the block-aligned range of items starting at q*block_size,
+	/// and only complete slots are used for blocks.
 	///////////////////////////////////////////////////////////////////////////
-	static inline iterator_type partition(iterator_type a, iterator_type b, comp_type & comp) {
-		iterator_type pivot = pick_pivot(a, b, comp);
+	struct distribution {
+		distribution(bucket range, comp_type comp)
+			: range(range), cls{comp, 0, 0}, spillBucket(0)
+		{
+		}
 
-		std::iter_swap(pivot, a);
-		iterator_type l = unguarded_partition(a, b, comp);
+		bucket range;
+		std::vector<value_type> splitters;
+		classifier cls;
+		std::vector<stripe> stripes;
+		/** Offset of each bucket, and the end of the range. */
+		std::vector<size_t> bucketBegin;
+		/** Number of blocks of each bucket. */
+		std::vector<size_t> blockCount;
+		/** Bucket of the block in each slot. */
+		std::vector<std::uint16_t> slots;
+		/** Slot each block is moved to. */
+		std::vector<size_t> dest;
+		/** The first slot and length of each cycle or path of moves. */
+		std::vector<std::pair<size_t, size_t> > chains;
+		/** A block whose slot is not complete, and its bucket. */
+		std::vector<value_type> spillBlock;
+		size_t spillBucket;
+
+		iterator_type slot(size_t q) {
+			return range.a + q * block_size;
+		}
 
-		return l;
-	}
+		size_t first_slot(size_t j) const {
+			return (bucketBegin[j] + block_size - 1) / block_size;
+		}
+	};
 
 #ifdef DOXYGEN
 public:
 #endif
 	///////////////////////////////////////////////////////////////////////////
-	/// \brief Represents quick sort work at a given level.
+	/// \brief Classifies the items of a stripe and writes full buffers back
+	/// as blocks.
 	///////////////////////////////////////////////////////////////////////////
-	class qsort_job : public job {
+	class classify_job : public job {
 	public:
-		///////////////////////////////////////////////////////////////////////
-		/// \brief Construct a qsort_job.
-		///////////////////////////////////////////////////////////////////////
-		qsort_job(iterator_type a, iterator_type b, comp_type comp, qsort_job * parent, progress_t & p)
-			: a(a), b(b), comp(comp), parent(parent), progress(p) {
+		classify_job(stripe & s, classifier cls)
+			: s(s), cls(cls) {
 
 			// Does nothing.
 		}
 
-		~qsort_job() {
-			for (size_t i = 0; i < children.size(); ++i) {
-				delete children[i];
+		virtual void operator()() override {
+			s.buffers.resize(cls.buckets());
+			iterator_type w = s.a;
+			for (iterator_type r = s.a; r != s.b; ++r) {
+				const size_t j = cls(*r);
+				std::vector<value_type> & buffer = s.buffers[j];
+				buffer.push_back(std::move(*r));
+				if (buffer.size() == block_size) {
+					// The block goes to positions that have already been read.
+					std::move(buffer.begin(), buffer.end(), w);
+					w += block_size;
+					buffer.clear();
+					s.blocks.push_back(static_cast<std::uint16_t>(j));
+				}
 			}
-			children.resize(0);
 		}
 
-		///////////////////////////////////////////////////////////////////////
-		/// Running a job with iterators a and b will repeatedly partition
-		/// [a,b), spawn a job on the left part and recurse on the right part,
-		/// until the min_size limit is reached.
-		///////////////////////////////////////////////////////////////////////
+	private:
+		stripe & s;
+		classifier cls;
+	};
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Moves the blocks along a subset of the chains of a
+	/// distribution.
+	///////////////////////////////////////////////////////////////////////////
+	class permute_job : public job {
+	public:
+		permute_job(distribution & d, size_t begin, size_t end)
+			: d(d), begin(begin), end(end) {
+
+			// Does nothing.
+		}
+
 		virtual void operator()() override {
-			assert(a <= b);
-			while (static_cast<size_t>(b - a) >= min_size) {
-				iterator_type pivot = partition(a, b, comp);
-				add_progress(b - a);
-				//qsort_job * j = tpie_new<qsort_job>(a, pivot, comp, this);
-				qsort_job * j = new qsort_job(a, pivot, comp, this, progress);
-				j->enqueue(this);
-				children.push_back(j);
-				a = pivot+1;
+			std::vector<value_type> block;
+			for (size_t c = begin; c != end; ++c) {
+				const size_t start = d.chains[c].first;
+				block.assign(std::make_move_iterator(d.slot(start)),
+							 std::make_move_iterator(d.slot(start) + block_size));
+				size_t q = d.dest[start];
+				while (true) {
+					if (q == spills) {
+						d.spillBlock.swap(block);
+						break;
+					}
+					if (q == start || d.dest[q] == no_block) {
+						// End of a cycle or a path.
+						std::move(block.begin(), block.end(), d.slot(q));
+						break;
+					}
+					std::swap_ranges(block.begin(), block.end(), d.slot(q));
+					q = d.dest[q];
+				}
 			}
-			std::sort(a, b, comp);
-			add_progress(sortWork(b - a));
 		}
 
-	protected:
-		virtual void on_done() override {
-			// Unfortunately, it might not be safe to delete our children at
-			// this point, as other threads might in theory wait for them to
-			// .join(). It is safer to postpone deletion until our own
-			// deletion.
-			if (!parent) {
-				std::lock_guard<std::mutex> lock(progress.mutex);
-				progress.work_estimate = progress.total_work_estimate;
-				progress.cond.notify_one();
+	private:
+		distribution & d;
+		size_t begin;
+		size_t end;
+	};
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Moves the items that are not in blocks to the unaligned ends
+	/// of their buckets.
+	///////////////////////////////////////////////////////////////////////////
+	class cleanup_job : public job {
+	public:
+		cleanup_job(distribution & d)
+			: d(d) {
+
+			// Does nothing.
+		}
+
+		virtual void operator()() override {
+			const size_t k = d.cls.buckets();
+			const iterator_type a = d.range.a;
+
+			// First save the items of blocks that stick out of their bucket,
+			// as they occupy the front of the next bucket.
+			std::vector<size_t> blocksEnd(k);
+			std::vector<std::vector<value_type> > overflow(k);
+			for (size_t j = 0; j < k; ++j) {
+				size_t placed = d.blockCount[j];
+				if (!d.spillBlock.empty() && d.spillBucket == j) --placed;
+				blocksEnd[j] = (d.first_slot(j) + placed) * block_size;
+				if (placed > 0 && blocksEnd[j] > d.bucketBegin[j+1])
+					overflow[j].assign(std::make_move_iterator(a + d.bucketBegin[j+1]),
+									   std::make_move_iterator(a + blocksEnd[j]));
+			}
+
+			for (size_t j = 0; j < k; ++j) {
+				const size_t bucketEnd = d.bucketBegin[j+1];
+				iterator_type out = a + d.bucketBegin[j];
+				iterator_type headEnd = a + bucketEnd;
+				iterator_type tail = a + bucketEnd;
+				if (blocksEnd[j] > d.first_slot(j) * block_size) {
+					headEnd = a + std::min(d.first_slot(j) * block_size, bucketEnd);
+					tail = a + std::min(blocksEnd[j], bucketEnd);
+				}
+				for (size_t s = 0; s < d.stripes.size(); ++s)
+					put(d.stripes[s].buffers[j], out, headEnd, tail);
+				if (!d.spillBlock.empty() && d.spillBucket == j)
+					put(d.spillBlock, out, headEnd, tail);
+				put(overflow[j], out, headEnd, tail);
+				tp_assert(out == a + bucketEnd || (out == headEnd && tail == a + bucketEnd),
+						  "Wrong number of items in bucket");
 			}
 		}
 
 	private:
-		iterator_type a;
-		iterator_type b;
-		comp_type comp;
-		qsort_job * parent;
-		progress_t & progress;
+		static void put(std::vector<value_type> & items, iterator_type & out,
+						iterator_type headEnd, iterator_type tail) {
+			for (size_t i = 0; i < items.size(); ++i) {
+				if (out == headEnd) out = tail;
+				*out = std::move(items[i]);
+				++out;
+			}
+			std::vector<value_type>().swap(items);
+		}
 
-		std::vector<qsort_job *> children;
+		distribution & d;
+	};
 
-		void add_progress(uint64_t amount) {
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Sorts a single bucket sequentially.
+	///////////////////////////////////////////////////////////////////////////
+	class sort_job : public job {
+	public:
+		sort_job(iterator_type a, iterator_type b, comp_type comp, progress_t & p)
+			: a(a), b(b), comp(comp), progress(p) {
+
+			// Does nothing.
+		}
+
+		virtual void operator()() override {
+			std::sort(a, b, comp);
 			std::lock_guard<std::mutex> lock(progress.mutex);
-			progress.work_estimate += amount;
+			progress.work_estimate += sortWork(b - a);
+			--progress.jobs_left;
 			progress.cond.notify_one();
 		}
+
+	private:
+		iterator_type a;
+		iterator_type b;
+		comp_type comp;
+		progress_t & progress;
 	};
+
 public:
-	parallel_sort_impl(typename P::base * p) {
+	parallel_sort_impl(typename P::base * p)
+		: m_workers(std::max(static_cast<memory_size_type>(1), default_worker_count()))
+		, m_reported(0)
+	{
 		progress.pi = p;
 	}
 
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Set the number of stripes each distribution is split into.
+	/// Defaults to the number of job threads.
+	///////////////////////////////////////////////////////////////////////////
+	void set_worker_count(size_t workers) {
+		m_workers = std::max(static_cast<size_t>(1), workers);
+	}
+
 	///////////////////////////////////////////////////////////////////////////
 	/// \brief Perform a parallel sort of the items in the interval [a,b).
 	/// Waits until all workers are done. The calling thread handles progress
@@ -248,42 +395,266 @@ public:
 	void operator()(iterator_type a, iterator_type b, comp_type comp=std::less<value_type>() ) {
 		progress.work_estimate = 0;
 		progress.total_work_estimate = sortWork(b-a);
+		progress.jobs_left = 0;
+		m_reported = 0;
 		if (progress.pi) progress.pi->init(progress.total_work_estimate);
 
-		if (static_cast<size_t>(b - a) < min_size) {
+		// With a single worker, distributing the items first would only add
+		// a pass over the input.
+		const size_t n = static_cast<size_t>(b - a);
+		if (n < min_size || m_workers == 1) {
 			std::sort(a, b, comp);
 			if (progress.pi) progress.pi->done();
 			return;
 		}
 
-		qsort_job * master = new qsort_job(a, b, comp, 0, progress);
-		master->enqueue();
+		// Buckets smaller than this are sorted by a single worker.
+		const size_t grain = std::max(min_size, n / (4 * m_workers));
+
+		std::vector<bucket> pending;
+		std::vector<bucket> small;
+		bucket all = {a, b};
+		pending.push_back(all);
+		while (!pending.empty()) {
+			std::vector<bucket> next;
+			distribute(pending, next, small, grain, comp);
+			pending.swap(next);
+			std::lock_guard<std::mutex> lock(progress.mutex);
+			report_progress();
+		}
+
+		std::vector<sort_job *> sorters;
+		progress.jobs_left = small.size();
+		for (size_t i = 0; i < small.size(); ++i) {
+			sorters.push_back(new sort_job(small[i].a, small[i].b, comp, progress));
+			sorters.back()->enqueue();
+		}
 
-		std::uint64_t prev_work_estimate = 0;
 		std::unique_lock<std::mutex> lock(progress.mutex);
-		while (progress.work_estimate < progress.total_work_estimate) {
-			if (progress.pi && progress.work_estimate > prev_work_estimate) progress.pi->step(progress.work_estimate - prev_work_estimate);
-			prev_work_estimate = progress.work_estimate;
+		while (progress.jobs_left) {
+			report_progress();
 			progress.cond.wait(lock);
 		}
 		lock.unlock();
 
-		master->join();
-		delete master;
+		for (size_t i = 0; i < sorters.size(); ++i) {
+			sorters[i]->join();
+			delete sorters[i];
+		}
 		if (progress.pi) progress.pi->done();
 	}
+
 private:
-	static const size_t max_job_count=256;
-	progress_t progress;
-	bool kill;
-	size_t working;
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Distribute every pending bucket into smaller buckets.
+	///
+	/// The resulting buckets are appended to next, or to small if they are to
+	/// be sorted by a single worker.
+	///////////////////////////////////////////////////////////////////////////
+	void distribute(const std::vector<bucket> & pending,
+					std::vector<bucket> & next,
+					std::vector<bucket> & small,
+					size_t grain,
+					comp_type & comp) {
+		std::uint64_t total = 0;
+		for (size_t i = 0; i < pending.size(); ++i)
+			total += static_cast<std::uint64_t>(pending[i].b - pending[i].a);
+
+		std::vector<std::unique_ptr<distribution> > ds;
+		for (size_t i = 0; i < pending.size(); ++i) {
+			ds.emplace_back(new distribution(pending[i], comp));
+			distribution & d = *ds.back();
+			take_sample(d, grain, comp);
+
+			// Give each bucket a share of the workers proportional to its
+			// size, and align the stripes to blocks.
+			const size_t size = static_cast<size_t>(d.range.b - d.range.a);
+			size_t stripes = static_cast<size_t>((m_workers * static_cast<std::uint64_t>(size) + total - 1) / total);
+			stripes = std::max(static_cast<size_t>(1), std::min(stripes, size / min_size));
+			d.stripes.resize(stripes);
+			for (size_t s = 0; s < stripes; ++s) {
+				d.stripes[s].a = d.range.a + (size * s / stripes) / block_size * block_size;
+				d.stripes[s].b = (s + 1 == stripes) ? d.range.b
+					: d.range.a + (size * (s + 1) / stripes) / block_size * block_size;
+			}
+		}
 
-	std::pair<iterator_type, iterator_type> jobs[max_job_count];
-	size_t job_count;
+		// Step 1: Classification.
+		std::vector<job *> jobs;
+		for (size_t i = 0; i < ds.size(); ++i)
+			for (size_t s = 0; s < ds[i]->stripes.size(); ++s)
+				jobs.push_back(new classify_job(ds[i]->stripes[s], ds[i]->cls));
+		run_jobs(jobs);
+
+		// Step 2: Block permutation. The chains of each distribution are
+		// divided among as many jobs as it has stripes.
+		for (size_t i = 0; i < ds.size(); ++i) {
+			distribution & d = *ds[i];
+			const size_t moves = plan_permutation(d);
+			const size_t workers = d.stripes.size();
+			size_t begin = 0;
+			size_t done = 0;
+			size_t part = 1;
+			for (size_t c = 0; c < d.chains.size(); ++c) {
+				done += d.chains[c].second;
+				if (c + 1 == d.chains.size() || done >= moves * part / workers) {
+					jobs.push_back(new permute_job(d, begin, c + 1));
+					begin = c + 1;
+					++part;
+				}
+			}
+		}
+		run_jobs(jobs);
+
+		// Step 3: Cleanup.
+		for (size_t i = 0; i < ds.size(); ++i)
+			jobs.push_back(new cleanup_job(*ds[i]));
+		run_jobs(jobs);
+
+		for (size_t i = 0; i < ds.size(); ++i) {
+			distribution & d = *ds[i];
+			for (size_t j = 0; j < d.cls.buckets(); j += 2) {
+				bucket r = {d.range.a + d.bucketBegin[j], d.range.a + d.bucketBegin[j+1]};
+				const size_t size = static_cast<size_t>(r.b - r.a);
+				if (size < 2) continue;
+				if (size < grain) small.push_back(r);
+				else next.push_back(r);
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(progress.mutex);
+		progress.work_estimate += total;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Run the given jobs in parallel, wait for them and delete them.
+	///////////////////////////////////////////////////////////////////////////
+	static void run_jobs(std::vector<job *> & jobs) {
+		for (size_t i = 0; i < jobs.size(); ++i) jobs[i]->enqueue();
+		for (size_t i = 0; i < jobs.size(); ++i) {
+			jobs[i]->join();
+			delete jobs[i];
+		}
+		jobs.clear();
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Compute bucket boundaries and the slot of every block after
+	/// classification, and split the moves into cycles and paths.
+	/// \returns The number of blocks to move.
+	///////////////////////////////////////////////////////////////////////////
+	static size_t plan_permutation(distribution & d) {
+		const size_t n = static_cast<size_t>(d.range.b - d.range.a);
+		const size_t k = d.cls.buckets();
+		const size_t slots = n / block_size;
+
+		d.blockCount.assign(k, 0);
+		d.bucketBegin.assign(k + 1, 0);
+		d.slots.assign(slots, empty_slot);
+		for (size_t s = 0; s < d.stripes.size(); ++s) {
+			stripe & st = d.stripes[s];
+			size_t q = static_cast<size_t>(st.a - d.range.a) / block_size;
+			for (size_t i = 0; i < st.blocks.size(); ++i) {
+				++d.blockCount[st.blocks[i]];
+				d.slots[q++] = st.blocks[i];
+			}
+			for (size_t j = 0; j < k; ++j)
+				d.bucketBegin[j+1] += st.buffers[j].size();
+		}
+		for (size_t j = 0; j < k; ++j)
+			d.bucketBegin[j+1] += d.bucketBegin[j] + d.blockCount[j] * block_size;
+
+		// Blocks already in the slots of their bucket stay; the rest are
+		// assigned the free slots of their bucket in order.
+		d.dest.assign(slots, no_block);
+		std::vector<size_t> cursor(k);
+		for (size_t j = 0; j < k; ++j) cursor[j] = d.first_slot(j);
+		for (size_t q = 0; q < slots; ++q) {
+			const size_t j = d.slots[q];
+			if (j != empty_slot && d.first_slot(j) <= q && q < d.first_slot(j) + d.blockCount[j])
+				d.dest[q] = stays;
+		}
+		size_t moves = 0;
+		for (size_t q = 0; q < slots; ++q) {
+			const size_t j = d.slots[q];
+			if (j == empty_slot || d.dest[q] == stays) continue;
+			size_t & c = cursor[j];
+			while (c < slots && d.slots[c] == j) ++c;
+			if (c >= slots) {
+				// The last slot of the bucket is not complete.
+				d.dest[q] = spills;
+				d.spillBucket = j;
+			} else {
+				tp_assert(c < d.first_slot(j) + d.blockCount[j], "Too many blocks in bucket");
+				d.dest[q] = c++;
+			}
+			++moves;
+		}
+
+		// Every slot is the destination of at most one block, so the moves
+		// form disjoint paths, which start in slots that are no destination,
+		// and cycles.
+		std::vector<bool> isDest(slots, false);
+		for (size_t q = 0; q < slots; ++q)
+			if (d.dest[q] < slots) isDest[d.dest[q]] = true;
+		std::vector<bool> visited(slots, false);
+		d.chains.clear();
+		for (int cycles = 0; cycles < 2; ++cycles) {
+			for (size_t q = 0; q < slots; ++q) {
+				if (visited[q] || (d.dest[q] >= slots && d.dest[q] != spills)) continue;
+				if (!cycles && isDest[q]) continue;
+				size_t length = 0;
+				size_t r = q;
+				do {
+					visited[r] = true;
+					++length;
+					r = d.dest[r];
+				} while (r < slots && r != q && d.dest[r] != no_block);
+				d.chains.push_back(std::make_pair(q, length));
+			}
+		}
+		return moves;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Draw the splitters of a distribution from a random sample.
+	///////////////////////////////////////////////////////////////////////////
+	void take_sample(distribution & d, size_t grain, comp_type & comp) {
+		const size_t size = static_cast<size_t>(d.range.b - d.range.a);
+		const size_t splitters = std::min(max_splitters, std::max(static_cast<size_t>(1), 2 * size / grain));
+		std::vector<value_type> & sample = d.splitters;
+		sample.reserve((splitters + 1) * oversampling);
+		for (size_t i = 0; i < (splitters + 1) * oversampling; ++i)
+			sample.push_back(*(d.range.a + static_cast<size_t>(m_rng() % size)));
+		std::sort(sample.begin(), sample.end(), comp);
+		for (size_t i = 0; i < splitters; ++i)
+			sample[i] = sample[(i + 1) * oversampling];
+		sample.erase(sample.begin() + splitters, sample.end());
+		sample.erase(std::unique(sample.begin(), sample.end(),
+								 [&comp](const value_type & x, const value_type & y) { return !comp(x, y); }),
+					 sample.end());
+		d.cls.first = &sample[0];
+		d.cls.last = &sample[0] + sample.size();
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Report the progress made since the last call to the progress
+	/// indicator. Called by the sorting thread with progress.mutex held.
+	///////////////////////////////////////////////////////////////////////////
+	void report_progress() {
+		std::uint64_t work = std::min(progress.work_estimate, progress.total_work_estimate);
+		if (progress.pi && work > m_reported) progress.pi->step(work - m_reported);
+		m_reported = std::max(m_reported, work);
+	}
+
+	progress_t progress;
+	size_t m_workers;
+	std::uint64_t m_reported;
+	std::mt19937_64 m_rng;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief Sort items in the range [a,b) using a parallel quick sort.
+/// \brief Sort items in the range [a,b) using a parallel sample sort.
 /// \param a Iterator to left boundary.
 /// \param b Iterator to right boundary.
 /// \param pi Progress tracker. No thread-safety required.
@@ -306,7 +677,7 @@ void parallel_sort(iterator_type a,
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief Sort items in the range [a,b) using a parallel quick sort.
+/// \brief Sort items in the range [a,b) using a parallel sample sort.
 /// \param a Iterator to left boundary.
 /// \param b Iterator to right boundary.
 /// \param comp Comparator.
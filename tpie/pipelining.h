@@ -47,6 +47,8 @@
 #include <tpie/pipelining/reverse.h>
 #include <tpie/pipelining/serialization.h>
 #include <tpie/pipelining/sort.h>
+#include <tpie/pipelining/partial_sort.h>
+#include <tpie/pipelining/distribution_sort.h>
 #include <tpie/pipelining/serialization_sort.h>
 #include <tpie/pipelining/std_glue.h>
 #include <tpie/pipelining/stdio.h>
@@ -0,0 +1,134 @@
+// -*- mode: c++; tab-width: 4; indent-tabs-mode: t; eval: (progn (c-set-style "stroustrup") (c-set-offset 'innamespace 0)); -*-
+// vi:set ts=4 sts=4 sw=4 noet :
+// Copyright 2026, The TPIE development team
+//
+// This file is part of TPIE.
+//
+// TPIE is free software: you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or (at your
+// option) any later version.
+//
+// TPIE is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with TPIE.  If not, see <http://www.gnu.org/licenses/>
+
+#ifndef __TPIE_PIPELINING_BTREE_H__
+#define __TPIE_PIPELINING_BTREE_H__
+
+#include <tpie/btree/btree_builder.h>
+#include <tpie/pipelining/node.h>
+#include <tpie/pipelining/pipe_base.h>
+#include <tpie/pipelining/factory_helpers.h>
+#include <tpie/pipelining/sort.h>
+#include <tpie/pipelining/serialization_sort.h>
+#include <type_traits>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \file pipelining/btree.h  Pipelining nodes that bulk load a B-tree.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace tpie::pipelining {
+namespace bits {
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Orders B-tree values by their keys, as the builder expects them.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename O>
+class btree_key_less {
+public:
+	typedef bbits::tree_state<T, O> state_type;
+	typedef typename state_type::keyextract_type keyextract_type;
+	typedef typename O::C comp_type;
+
+	btree_key_less(const comp_type & comp) : m_comp(comp) {}
+
+	bool operator()(const T & a, const T & b) const {
+		return m_comp(m_keyExtract(a), m_keyExtract(b));
+	}
+
+private:
+	comp_type m_comp;
+	keyextract_type m_keyExtract;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Pipelining node that pushes items to a B-tree builder.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename O>
+class btree_builder_t : public node {
+public:
+	typedef T item_type;
+	typedef bbits::builder<T, O> builder_type;
+
+	btree_builder_t(builder_type & builder) : m_builder(builder) {
+		set_name("B-tree builder", PRIORITY_INSIGNIFICANT);
+	}
+
+	void push(const item_type & item) {
+		m_builder.push(item);
+	}
+
+private:
+	builder_type & m_builder;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Chooses the sorter in front of the builder. Values that cannot be
+/// stored in a plain file_stream, which only serialized B-trees may hold, are
+/// sorted by the serialization sorter.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename O,
+		  bool serialize = bbits::tree_state<T, O>::is_serialized && !std::is_trivially_copyable<T>::value>
+struct btree_sorter {
+	typedef btree_key_less<T, O> pred_t;
+	typedef pipe_middle<sort_factory<pred_t, default_store> > type;
+	static type get(const pred_t & pred) {return sort(pred);}
+};
+
+template <typename T, typename O>
+struct btree_sorter<T, O, true> {
+	typedef btree_key_less<T, O> pred_t;
+	typedef pipe_middle<serialization_bits::sort_factory<pred_t> > type;
+	static type get(const pred_t & pred) {return serialization_sort(pred);}
+};
+
+} // namespace bits
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Pipelining node that pushes items to a B-tree builder. The items
+/// must arrive in the order of the builder's comparator. Call build() on the
+/// builder after the pipeline has run to obtain the tree.
+/// \param builder  The builder to push items to
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename O>
+inline pipe_end<termfactory<bits::btree_builder_t<T, O>, bbits::builder<T, O> &> >
+btree_build(bbits::builder<T, O> & builder) {
+	return {builder};
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Pipelining node that sorts items by the key order of a B-tree
+/// builder and pushes them to the builder.
+///
+/// The final merge of the sort pushes directly to the builder, so the sorted
+/// items are never written to a stream before the tree is built. Values of
+/// serialized B-trees that are not trivially copyable are sorted with
+/// serialization_sort. Call build() on the builder after the pipeline has
+/// run to obtain the tree.
+/// \param builder  The builder to push items to
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename O>
+inline auto sort_into_btree(bbits::builder<T, O> & builder) {
+	static_assert(bbits::tree_state<T, O>::is_ordered, "Unordered B-trees need no sorting");
+	typedef bits::btree_sorter<T, O> sorter;
+	return sorter::get(typename sorter::pred_t(builder.comparator())) | btree_build(builder);
+}
+
+} // namespace tpie::pipelining
+
+#endif // __TPIE_PIPELINING_BTREE_H__
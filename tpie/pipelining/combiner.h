@@ -0,0 +1,101 @@
+// -*- mode: c++; tab-width: 4; indent-tabs-mode: t; c-file-style: "stroustrup"; -*-
+// vi:set ts=4 sts=4 sw=4 noet :
+// Copyright 2026, The TPIE development team
+//
+// This file is part of TPIE.
+//
+// TPIE is free software: you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or (at your
+// option) any later version.
+//
+// TPIE is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with TPIE.  If not, see <http://www.gnu.org/licenses/>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \file combiner.h  Combining equal items while sorting.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __TPIE_PIPELINING_COMBINER_H__
+#define __TPIE_PIPELINING_COMBINER_H__
+
+namespace tpie {
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Less-than predicate that also tells the sorter how to combine
+/// items that compare equal.
+///
+/// When merge_sorter is given a combining_pred, every run it writes and
+/// every merge it performs replaces a group of equal items by a single
+/// item, so the amount of data shrinks with each pass. The combine
+/// function must be associative, and the combined item must compare equal
+/// to the items it was made from:
+///
+/// \code
+/// T combine(const T & a, const T & b);
+/// \endcode
+///
+/// Runs formed by replacement selection are written without combining;
+/// their duplicates are combined when the runs are merged.
+///////////////////////////////////////////////////////////////////////////////
+template <typename pred_t, typename combine_t>
+class combining_pred {
+public:
+	combining_pred(pred_t pred = pred_t(), combine_t combine = combine_t())
+		: m_pred(pred), m_combine(combine) {}
+
+	template <typename A, typename B>
+	bool operator()(const A & a, const B & b) const {
+		return m_pred(a, b);
+	}
+
+	template <typename A, typename B>
+	bool operator()(const A & a, const B & b) {
+		return m_pred(a, b);
+	}
+
+	template <typename T>
+	T combine(const T & a, const T & b) {
+		return m_combine(a, b);
+	}
+
+private:
+	pred_t m_pred;
+	combine_t m_combine;
+};
+
+namespace bits {
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Tells merge_sorter whether pred_t combines equal items.
+///////////////////////////////////////////////////////////////////////////////
+template <typename pred_t>
+struct sort_combiner {
+	static const bool enabled = false;
+
+	template <typename T>
+	static T combine(pred_t &, const T & a, const T &) {
+		return a;
+	}
+};
+
+template <typename pred_t, typename combine_t>
+struct sort_combiner<combining_pred<pred_t, combine_t> > {
+	static const bool enabled = true;
+
+	template <typename T>
+	static T combine(combining_pred<pred_t, combine_t> & pred, const T & a, const T & b) {
+		return pred.combine(a, b);
+	}
+};
+
+} // namespace bits
+
+} // namespace tpie
+
+#endif // __TPIE_PIPELINING_COMBINER_H__
@@ -0,0 +1,620 @@
+// -*- mode: c++; tab-width: 4; indent-tabs-mode: t; eval: (progn (c-set-style "stroustrup") (c-set-offset 'innamespace 0)); -*-
+// vi:set ts=4 sts=4 sw=4 noet :
+// Copyright 2026, The TPIE development team
+//
+// This file is part of TPIE.
+//
+// TPIE is free software: you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or (at your
+// option) any later version.
+//
+// TPIE is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with TPIE.  If not, see <http://www.gnu.org/licenses/>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \file distribution_sort.h  Pipelining node sorting by distributing items
+/// into buckets delimited by sampled splitters.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __TPIE_PIPELINING_DISTRIBUTION_SORT_H__
+#define __TPIE_PIPELINING_DISTRIBUTION_SORT_H__
+
+#include <tpie/pipelining/node.h>
+#include <tpie/pipelining/pipe_base.h>
+#include <tpie/pipelining/factory_base.h>
+#include <tpie/pipelining/merge_sorter.h>
+#include <tpie/pipelining/sort_parameters.h>
+#include <tpie/parallel_sort.h>
+#include <tpie/file_stream.h>
+#include <tpie/tempname.h>
+#include <tpie/array.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace tpie::pipelining {
+namespace bits {
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief State shared by the input and output nodes of distribution_sort.
+///
+/// The first items are kept in a buffer. If all items fit, they are sorted
+/// in memory. Otherwise, splitters are sampled from the buffer, and the
+/// buffer and the remaining items are scattered into bucket files. In the
+/// output phase, each bucket is read, sorted in memory with parallel_sort
+/// and reported in order.
+///
+/// A uniform random sample of every bucket is kept while it is written.
+/// A bucket that does not fit in memory is distributed again with splitters
+/// taken from its sample. If that puts all of its items in one bucket, the
+/// items equal to the splitter below that bucket, typically a frequent key,
+/// are reported without sorting and the rest are distributed again. Items
+/// that still cannot be split are sorted with a merge sort.
+///
+/// The parameters are kept in a sort_parameters: runLength is the number of
+/// items sorted in memory in the output phase, fanout is the number of
+/// buckets in the input phase and finalFanout the number of buckets when a
+/// bucket is distributed again.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename pred_t>
+class distribution_sorter {
+public:
+	typedef T item_type;
+
+	static const memory_size_type minimumFilesPhase1 = 2;
+	static const memory_size_type minimumFilesPhase3 = 3;
+
+	distribution_sorter(pred_t pred)
+		: m_pred(pred)
+		, m_items(0)
+		, m_expectedItems(0)
+		, m_begun(false)
+		, m_parametersSet(false)
+		, m_scattering(false)
+		, m_buffered(0)
+		, m_rng(0x5eed)
+	{
+		m_params.filesPhase1 = m_params.filesPhase2 = m_params.filesPhase3 = 0;
+		m_params.memoryPhase1 = m_params.memoryPhase2 = m_params.memoryPhase3 = 0;
+		m_params.runLength = m_params.internalReportThreshold = 0;
+		m_params.fanout = m_params.finalFanout = 0;
+		m_params.runFormation = run_formation_sort;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Memory used for each bucket being written: its stream and
+	/// its sample.
+	///////////////////////////////////////////////////////////////////////////
+	static memory_size_type bucket_memory_usage() {
+		return file_stream<T>::memory_usage() + sampleSize * sizeof(T) + sizeof(bucket);
+	}
+
+	static memory_size_type minimum_memory_phase_1() {
+		return minimumFilesPhase1 * bucket_memory_usage() + minimumBufferItems * sizeof(T);
+	}
+
+	static memory_size_type minimum_memory_phase_3() {
+		return file_stream<T>::memory_usage() + (minimumFilesPhase3 - 1) * bucket_memory_usage()
+			+ minimumBufferItems * sizeof(T);
+	}
+
+	// Parameters are only taken before begin(), since resources are assigned
+	// to the phases again once the pipeline is running.
+	void set_phase_1_memory(memory_size_type m) {
+		if (!m_begun) m_params.memoryPhase1 = m;
+	}
+
+	void set_phase_3_memory(memory_size_type m) {
+		if (!m_begun) m_params.memoryPhase3 = m;
+	}
+
+	void set_phase_1_files(memory_size_type f) {
+		if (!m_begun) m_params.filesPhase1 = f;
+	}
+
+	void set_phase_3_files(memory_size_type f) {
+		if (!m_begun) m_params.filesPhase3 = f;
+	}
+
+	void set_items(stream_size_type n) {
+		if (!m_begun) m_expectedItems = n;
+	}
+
+	const sort_parameters & get_parameters() const {
+		return m_params;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief The number of bucket files written in the input phase, or zero
+	/// if the items were sorted in memory.
+	///////////////////////////////////////////////////////////////////////////
+	memory_size_type bucket_count() const {
+		return m_buckets.size();
+	}
+
+	void begin() {
+		m_begun = true;
+		calculate_parameters();
+		m_buffer.resize(m_params.internalReportThreshold);
+		m_buffered = 0;
+		m_items = 0;
+		m_scattering = false;
+	}
+
+	void push(const item_type & item) {
+		++m_items;
+		if (m_scattering) {
+			scatter(item);
+			return;
+		}
+		if (m_buffered < m_buffer.size()) {
+			m_buffer[m_buffered++] = item;
+			return;
+		}
+		begin_scatter();
+		scatter(item);
+	}
+
+	void end() {
+		if (m_scattering) {
+			close_buckets();
+			log_pipe_debug() << "distribution_sort: scattered " << m_items << " items into "
+							 << m_buckets.size() << " buckets" << std::endl;
+		} else {
+			parallel_sort(m_buffer.begin(), m_buffer.begin() + m_buffered, m_pred);
+		}
+	}
+
+	stream_size_type item_count() const {
+		return m_items;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Push the items in sorted order to dest.
+	///////////////////////////////////////////////////////////////////////////
+	template <typename dest_t>
+	void report(dest_t & dest, progress_indicator_base & pi) {
+		pi.init(m_items);
+		if (!m_scattering) {
+			for (memory_size_type i = 0; i < m_buffered; ++i) {
+				dest.push(m_buffer[i]);
+				pi.step();
+			}
+		} else {
+			std::vector<std::unique_ptr<bucket> > buckets;
+			buckets.swap(m_buckets);
+			for (size_t i = 0; i < buckets.size(); ++i) {
+				report_bucket(*buckets[i], 0, dest, pi);
+				buckets[i].reset();
+			}
+		}
+		pi.done();
+	}
+
+	void done() {
+		m_buffer.resize(0);
+		m_buckets.clear();
+	}
+
+private:
+	// Items in the sample kept for each bucket.
+	static const memory_size_type sampleSize = 256;
+	// Sample items per splitter when choosing splitters from the buffer.
+	static const memory_size_type oversampling = 16;
+	static const memory_size_type minimumBufferItems = 16;
+	// Distribution levels before resorting to merge sort.
+	static const memory_size_type maximumDepth = 8;
+
+	struct bucket {
+		temp_file file;
+		stream_size_type items;
+		array<T> sample;
+		memory_size_type sampled;
+		// The splitter below the bucket, which is a lower bound on its items
+		bool hasLower;
+		T lower;
+
+		bucket() : items(0), sample(sampleSize), sampled(0), hasLower(false), lower() {}
+	};
+
+	void calculate_parameters() {
+		if (m_parametersSet) return;
+		m_parametersSet = true;
+		if (m_params.filesPhase1 == 0) m_params.filesPhase1 = 253;
+		if (m_params.filesPhase3 == 0) m_params.filesPhase3 = 253;
+		m_params.filesPhase2 = m_params.filesPhase3;
+		m_params.memoryPhase2 = m_params.memoryPhase3;
+
+		memory_size_type streamMemory = file_stream<T>::memory_usage();
+
+		// Output phase: one bucket is read while it is sorted in memory,
+		// or distributed again into finalFanout buckets.
+		memory_size_type mem3 = std::max(m_params.memoryPhase3, minimum_memory_phase_3());
+		m_params.runLength = (mem3 - streamMemory) / sizeof(T);
+		m_params.finalFanout = clamp(minimumFilesPhase3 - 1,
+									 (mem3 - streamMemory) / 2 / bucket_memory_usage(),
+									 m_params.filesPhase3 - 1);
+
+		// Input phase: use at most half the memory for buckets and keep the
+		// rest for the first items. With a known item count, use no more
+		// buckets than needed for each to fit in memory twice over.
+		memory_size_type mem1 = std::max(m_params.memoryPhase1, minimum_memory_phase_1());
+		memory_size_type fanout = clamp(minimumFilesPhase1,
+										mem1 / 2 / bucket_memory_usage(),
+										m_params.filesPhase1);
+		if (m_expectedItems > 0) {
+			stream_size_type needed = 2 * m_expectedItems / m_params.runLength + 1;
+			fanout = clamp(minimumFilesPhase1, static_cast<memory_size_type>(std::min<stream_size_type>(needed, fanout)), fanout);
+		}
+		m_params.fanout = fanout;
+		m_params.internalReportThreshold = std::min(
+			(mem1 - fanout * bucket_memory_usage()) / sizeof(T),
+			m_params.runLength);
+
+		log_pipe_debug() << "Calculated distribution sort parameters\n";
+		m_params.dump(log_pipe_debug());
+		log_pipe_debug() << std::flush;
+	}
+
+	static memory_size_type clamp(memory_size_type lo, memory_size_type val, memory_size_type hi) {
+		return std::max(lo, std::min(val, hi));
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Choose splitters as evenly spaced items of the sorted sample.
+	///////////////////////////////////////////////////////////////////////////
+	void choose_splitters(T * sample, memory_size_type n, memory_size_type buckets) {
+		std::sort(sample, sample + n, m_pred);
+		m_splitters.resize(buckets - 1);
+		for (memory_size_type i = 0; i + 1 < buckets; ++i)
+			m_splitters[i] = sample[(i + 1) * n / buckets];
+	}
+
+	memory_size_type bucket_index(const T & item) const {
+		return std::upper_bound(m_splitters.begin(), m_splitters.end(), item, m_pred)
+			- m_splitters.begin();
+	}
+
+	// Open n buckets, the first of them for the intervals between the
+	// splitters.
+	void open_buckets(memory_size_type n) {
+		m_buckets.clear();
+		m_streams.resize(n);
+		for (memory_size_type i = 0; i < n; ++i) {
+			m_buckets.emplace_back(new bucket());
+			m_streams[i].open(m_buckets[i]->file, access_write);
+			if (i > 0 && i <= m_splitters.size()) {
+				m_buckets[i]->hasLower = true;
+				m_buckets[i]->lower = m_splitters[i - 1];
+			}
+		}
+	}
+
+	void close_buckets() {
+		for (memory_size_type i = 0; i < m_streams.size(); ++i) m_streams[i].close();
+		m_streams.resize(0);
+		m_splitters.resize(0);
+	}
+
+	void write_to_bucket(const T & item) {
+		write_to_bucket(item, bucket_index(item));
+	}
+
+	// Write the item to a bucket, keeping a uniform sample of the bucket.
+	void write_to_bucket(const T & item, memory_size_type i) {
+		bucket & b = *m_buckets[i];
+		m_streams[i].write(item);
+		++b.items;
+		if (b.sampled < sampleSize) {
+			b.sample[b.sampled++] = item;
+		} else {
+			stream_size_type j = std::uniform_int_distribution<stream_size_type>(0, b.items - 1)(m_rng);
+			if (j < sampleSize) b.sample[static_cast<memory_size_type>(j)] = item;
+		}
+	}
+
+	void begin_scatter() {
+		memory_size_type sampled = std::min(m_buffered, oversampling * m_params.fanout);
+		array<T> sample(sampled);
+		std::uniform_int_distribution<memory_size_type> position(0, m_buffered - 1);
+		for (memory_size_type i = 0; i < sampled; ++i) sample[i] = m_buffer[position(m_rng)];
+		choose_splitters(sample.get(), sampled, m_params.fanout);
+		sample.resize(0);
+
+		open_buckets(m_params.fanout);
+		for (memory_size_type i = 0; i < m_buffered; ++i) write_to_bucket(m_buffer[i]);
+		m_buffer.resize(0);
+		m_buffered = 0;
+		m_scattering = true;
+	}
+
+	void scatter(const item_type & item) {
+		write_to_bucket(item);
+	}
+
+	template <typename dest_t>
+	void report_bucket(bucket & b, memory_size_type depth, dest_t & dest, progress_indicator_base & pi) {
+		if (b.items == 0) return;
+		file_stream<T> in;
+		in.open(b.file, access_read);
+
+		if (b.items <= m_params.runLength) {
+			memory_size_type n = static_cast<memory_size_type>(b.items);
+			array<T> items(n);
+			for (memory_size_type i = 0; i < n; ++i) items[i] = in.read();
+			in.close();
+			b.file.free();
+			parallel_sort(items.begin(), items.end(), m_pred);
+			for (memory_size_type i = 0; i < n; ++i) {
+				dest.push(items[i]);
+				pi.step();
+			}
+			return;
+		}
+
+		if (depth >= maximumDepth) {
+			merge_sort_bucket(in, dest, pi);
+			in.close();
+			b.file.free();
+			return;
+		}
+
+		// Distribute the bucket again with splitters from its sample.
+		memory_size_type fanout = std::min(m_params.finalFanout, b.sampled);
+		choose_splitters(b.sample.get(), b.sampled, fanout);
+		b.sample.resize(0);
+		open_buckets(fanout);
+		while (in.can_read()) write_to_bucket(in.read());
+		in.close();
+		b.file.free();
+		close_buckets();
+
+		std::vector<std::unique_ptr<bucket> > buckets;
+		buckets.swap(m_buckets);
+		for (size_t i = 0; i < buckets.size(); ++i) {
+			if (buckets[i]->items == b.items)
+				report_unsplit_bucket(*buckets[i], depth + 1, dest, pi);
+			else
+				report_bucket(*buckets[i], depth + 1, dest, pi);
+			buckets[i].reset();
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Report a bucket that received all items of its parent. The items
+	/// equal to its lower splitter are reported as they are, and the greater
+	/// items are distributed again.
+	///////////////////////////////////////////////////////////////////////////
+	template <typename dest_t>
+	void report_unsplit_bucket(bucket & b, memory_size_type depth, dest_t & dest, progress_indicator_base & pi) {
+		file_stream<T> in;
+		in.open(b.file, access_read);
+		if (!b.hasLower || depth >= maximumDepth) {
+			log_pipe_debug() << "distribution_sort: bucket of " << b.items
+							 << " items could not be split; merge sorting it" << std::endl;
+			merge_sort_bucket(in, dest, pi);
+			in.close();
+			b.file.free();
+			return;
+		}
+
+		m_splitters.resize(0);
+		open_buckets(2);
+		while (in.can_read()) {
+			const T & item = in.read();
+			write_to_bucket(item, m_pred(b.lower, item) ? 1 : 0);
+		}
+		in.close();
+		b.file.free();
+		close_buckets();
+
+		std::vector<std::unique_ptr<bucket> > buckets;
+		buckets.swap(m_buckets);
+		log_pipe_debug() << "distribution_sort: split " << buckets[0]->items
+						 << " items equal to a splitter off a bucket of " << b.items << std::endl;
+		if (buckets[0]->items == 0) {
+			report_unsplit_bucket(*buckets[1], maximumDepth, dest, pi);
+			return;
+		}
+		file_stream<T> equal;
+		equal.open(buckets[0]->file, access_read);
+		while (equal.can_read()) {
+			dest.push(equal.read());
+			pi.step();
+		}
+		equal.close();
+		buckets[0].reset();
+		report_bucket(*buckets[1], depth, dest, pi);
+	}
+
+	template <typename dest_t>
+	void merge_sort_bucket(file_stream<T> & in, dest_t & dest, progress_indicator_base & pi) {
+		merge_sorter<T, false, pred_t> sorter(m_pred);
+		memory_size_type memory = m_params.memoryPhase3 - file_stream<T>::memory_usage();
+		sorter.set_available_memory(std::max(memory, sorter.minimum_memory_phase_2()));
+		sorter.set_available_files(m_params.filesPhase3 - 1);
+		sorter.begin();
+		while (in.can_read()) sorter.push(in.read());
+		sorter.end();
+		dummy_progress_indicator dpi;
+		sorter.calc(dpi);
+		while (sorter.can_pull()) {
+			dest.push(sorter.pull());
+			pi.step();
+		}
+	}
+
+	pred_t m_pred;
+	sort_parameters m_params;
+	stream_size_type m_items;
+	stream_size_type m_expectedItems;
+	bool m_begun;
+	bool m_parametersSet;
+	bool m_scattering;
+
+	array<T> m_buffer;
+	memory_size_type m_buffered;
+
+	array<T> m_splitters;
+	std::vector<std::unique_ptr<bucket> > m_buckets;
+	array<file_stream<T> > m_streams;
+	std::mt19937_64 m_rng;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Output node of distribution_sort. Reports the items in sorted
+/// order in the phase after the input node.
+///////////////////////////////////////////////////////////////////////////////
+template <typename pred_t, typename dest_t>
+class distribution_sort_output_t : public node {
+public:
+	typedef typename push_type<dest_t>::type item_type;
+	typedef distribution_sorter<item_type, pred_t> sorter_t;
+
+	distribution_sort_output_t(dest_t dest, std::shared_ptr<sorter_t> sorter, const node_token & input_token)
+		: m_sorter(sorter)
+		, dest(std::move(dest))
+	{
+		add_dependency(input_token);
+		add_push_destination(this->dest);
+		set_minimum_resource_usage(FILES, sorter_t::minimumFilesPhase3);
+		set_resource_fraction(FILES, 1.0);
+		set_minimum_memory(sorter_t::minimum_memory_phase_3());
+		set_memory_fraction(1.0);
+		set_name("Write sorted buckets", PRIORITY_INSIGNIFICANT);
+		set_plot_options(PLOT_BUFFERED);
+	}
+
+	void propagate() override {
+		forward("items", m_sorter->item_count());
+	}
+
+	void go() override {
+		m_sorter->report(dest, *proxy_progress_indicator());
+	}
+
+	void end() override {
+		m_sorter->done();
+	}
+
+protected:
+	void resource_available_changed(resource_type type, memory_size_type available) override {
+		if (type == MEMORY)
+			m_sorter->set_phase_3_memory(available);
+		else if (type == FILES)
+			m_sorter->set_phase_3_files(available);
+	}
+
+private:
+	std::shared_ptr<sorter_t> m_sorter;
+	dest_t dest;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Input node of distribution_sort.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename pred_t>
+class distribution_sort_input_t : public node {
+public:
+	typedef T item_type;
+	typedef distribution_sorter<item_type, pred_t> sorter_t;
+
+	distribution_sort_input_t(std::shared_ptr<sorter_t> sorter, const node_token & token, std::shared_ptr<node> output)
+		: node(token)
+		, m_sorter(sorter)
+		, m_output(output)
+	{
+		set_name("Distribute items", PRIORITY_SIGNIFICANT);
+		set_minimum_resource_usage(FILES, sorter_t::minimumFilesPhase1);
+		set_resource_fraction(FILES, 1.0);
+		set_minimum_memory(sorter_t::minimum_memory_phase_1());
+		set_memory_fraction(1.0);
+		set_plot_options(PLOT_BUFFERED | PLOT_SIMPLIFIED_HIDE);
+	}
+
+	void propagate() override {
+		if (can_fetch("items"))
+			m_sorter->set_items(fetch<stream_size_type>("items"));
+	}
+
+	void begin() override {
+		m_sorter->begin();
+	}
+
+	void push(const item_type & item) {
+		m_sorter->push(item);
+	}
+
+	void end() override {
+		m_sorter->end();
+	}
+
+protected:
+	void resource_available_changed(resource_type type, memory_size_type available) override {
+		if (type == MEMORY)
+			m_sorter->set_phase_1_memory(available);
+		else if (type == FILES)
+			m_sorter->set_phase_1_files(available);
+	}
+
+private:
+	std::shared_ptr<sorter_t> m_sorter;
+	std::shared_ptr<node> m_output;
+};
+
+template <typename pred_t>
+class distribution_sort_factory : public factory_base {
+public:
+	template <typename dest_t>
+	using constructed_type = distribution_sort_input_t<typename push_type<dest_t>::type, pred_t>;
+
+	distribution_sort_factory(const pred_t & pred)
+		: m_pred(pred) {}
+
+	template <typename dest_t>
+	constructed_type<dest_t> construct(dest_t dest) {
+		typedef typename push_type<dest_t>::type item_type;
+		typedef distribution_sorter<item_type, pred_t> sorter_t;
+		std::shared_ptr<sorter_t> sorter = std::make_shared<sorter_t>(m_pred);
+		node_token input_token;
+		std::shared_ptr<distribution_sort_output_t<pred_t, dest_t> > output =
+			std::make_shared<distribution_sort_output_t<pred_t, dest_t> >(std::move(dest), sorter, input_token);
+		this->init_sub_node(*output);
+		constructed_type<dest_t> input(sorter, input_token, output);
+		this->init_sub_node(input);
+		return input;
+	}
+
+private:
+	pred_t m_pred;
+};
+
+} // namespace bits
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief A pipelining node that sorts the items under pred by distributing
+/// them into bucket files and sorting each bucket in memory, creating a
+/// phase boundary.
+///
+/// Unlike sort(), the items are written and read once when the buckets fit
+/// in memory, and no merge heap is used. This suits keys with a spread-out
+/// distribution, such as hash values or random ids. Buckets that do not fit
+/// in memory are distributed again, and merge sorted as a last resort.
+///////////////////////////////////////////////////////////////////////////////
+template <typename pred_t=std::less<void> >
+inline pipe_middle<bits::distribution_sort_factory<pred_t> >
+distribution_sort(const pred_t & p=pred_t()) {
+	typedef bits::distribution_sort_factory<pred_t> fact;
+	return pipe_middle<fact>(fact(p)).name("Distribution sort");
+}
+
+} // namespace tpie::pipelining
+
+#endif // __TPIE_PIPELINING_DISTRIBUTION_SORT_H__
@@ -0,0 +1,301 @@
+// -*- mode: c++; tab-width: 4; indent-tabs-mode: t; c-file-style: "stroustrup"; -*-
+// vi:set ts=4 sts=4 sw=4 noet :
+// Copyright 2026, The TPIE development team
+//
+// This file is part of TPIE.
+//
+// TPIE is free software: you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or (at your
+// option) any later version.
+//
+// TPIE is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with TPIE.  If not, see <http://www.gnu.org/licenses/>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \file key_prefix.h  Normalized key prefixes for sorting wide items.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __TPIE_PIPELINING_KEY_PREFIX_H__
+#define __TPIE_PIPELINING_KEY_PREFIX_H__
+
+#include <tpie/types.h>
+#include <tpie/array.h>
+#include <tpie/parallel_sort.h>
+#include <tpie/pipelining/store.h>
+
+namespace tpie {
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Normalized key prefix extractor for items of type T ordered by
+/// pred_t.
+///
+/// By default no prefix is used. Specialize this trait to make merge_sorter
+/// sort wide items through an array of compact (prefix, index) pairs, and to
+/// keep prefixes next to the items in the heap of the merger. The full
+/// comparator is only invoked when two prefixes are equal.
+///
+/// A specialization must provide:
+///
+/// \code
+/// static const bool enabled = true;
+/// typedef std::uint64_t prefix_type; // or any small type with operator<
+/// static prefix_type prefix(const T & item);
+/// \endcode
+///
+/// The prefix must be consistent with the comparator: if
+/// prefix(a) < prefix(b), then pred(a, b) must hold.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename pred_t>
+struct key_prefix {
+	static const bool enabled = false;
+};
+
+namespace bits {
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Index of an item in the run buffer along with its key prefix.
+///////////////////////////////////////////////////////////////////////////////
+template <typename prefix_type>
+struct prefix_index {
+	prefix_type prefix;
+	memory_size_type index;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Comparator for prefix_index entries of a run buffer. Entries are
+/// ordered by prefix, and ties are broken by comparing the items. If stable,
+/// equal items are ordered by their index in the run buffer.
+///////////////////////////////////////////////////////////////////////////////
+template <typename pred_t, typename specific_store_t>
+class prefix_index_pred {
+private:
+	typedef typename specific_store_t::store_type store_type;
+	typedef key_prefix<typename specific_store_t::element_type, pred_t> prefix_t;
+	typedef prefix_index<typename prefix_t::prefix_type> entry_type;
+
+	store_pred<pred_t, specific_store_t> pred;
+	const store_type * items;
+	bool stable;
+
+public:
+	prefix_index_pred(pred_t pred, const store_type * items, bool stable)
+		: pred(pred), items(items), stable(stable) {}
+
+	bool operator()(const entry_type & lhs, const entry_type & rhs) {
+		if (lhs.prefix < rhs.prefix) return true;
+		if (rhs.prefix < lhs.prefix) return false;
+		if (pred(items[lhs.index], items[rhs.index])) return true;
+		if (!stable || pred(items[rhs.index], items[lhs.index])) return false;
+		return lhs.index < rhs.index;
+	}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Item in the heap of a merger: a stored item and the number of the
+/// run it came from. If key prefixes are enabled, the prefix of the item is
+/// kept alongside it and compared first.
+///////////////////////////////////////////////////////////////////////////////
+template <typename specific_store_t, typename pred_t,
+		  bool = key_prefix<typename specific_store_t::element_type, pred_t>::enabled>
+struct merge_heap_item {
+	typedef typename specific_store_t::store_type store_type;
+
+	merge_heap_item() {}
+	merge_heap_item(store_type && item, size_t run)
+		: item(std::move(item)), run(run) {}
+
+	static bool less(store_pred<pred_t, specific_store_t> & pred,
+					 const merge_heap_item & lhs, const merge_heap_item & rhs) {
+		return pred(lhs.item, rhs.item);
+	}
+
+	store_type item;
+	size_t run;
+};
+
+template <typename specific_store_t, typename pred_t>
+struct merge_heap_item<specific_store_t, pred_t, true> {
+	typedef typename specific_store_t::store_type store_type;
+	typedef key_prefix<typename specific_store_t::element_type, pred_t> prefix_t;
+
+	merge_heap_item() {}
+	merge_heap_item(store_type && item, size_t run)
+		: prefix(prefix_t::prefix(specific_store_t::store_as_element(item)))
+		, item(std::move(item)), run(run) {}
+
+	static bool less(store_pred<pred_t, specific_store_t> & pred,
+					 const merge_heap_item & lhs, const merge_heap_item & rhs) {
+		if (lhs.prefix < rhs.prefix) return true;
+		if (rhs.prefix < lhs.prefix) return false;
+		return pred(lhs.item, rhs.item);
+	}
+
+	typename prefix_t::prefix_type prefix;
+	store_type item;
+	size_t run;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Memory overhead per item in the run buffer of merge_sorter.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename pred_t, bool = key_prefix<T, pred_t>::enabled>
+struct prefix_index_size {
+	static const size_t value = 0;
+};
+
+template <typename T, typename pred_t>
+struct prefix_index_size<T, pred_t, true> {
+	static const size_t value = sizeof(prefix_index<typename key_prefix<T, pred_t>::prefix_type>);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Sorts the run buffer of merge_sorter in place. Used when no key
+/// prefix is available.
+///////////////////////////////////////////////////////////////////////////////
+template <typename specific_store_t, typename pred_t,
+		  bool = key_prefix<typename specific_store_t::element_type, pred_t>::enabled>
+class run_sorter {
+public:
+	typedef typename specific_store_t::store_type store_type;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Extra memory per item used by a stable sort of the run buffer.
+	/// std::stable_sort allocates a buffer of half the items.
+	///////////////////////////////////////////////////////////////////////////
+	static const memory_size_type stable_item_overhead = (sizeof(store_type) + 1) / 2;
+
+	run_sorter(memory_bucket_ref) : m_stable(false) {}
+
+	void resize(memory_size_type) {}
+
+	void set_stable(bool stable) {
+		m_stable = stable;
+	}
+
+	void sort(array<store_type> & items, memory_size_type n, pred_t pred) {
+		if (m_stable)
+			std::stable_sort(items.begin(), items.begin()+n, store_pred<pred_t, specific_store_t>(pred));
+		else
+			parallel_sort(items.begin(), items.begin()+n, store_pred<pred_t, specific_store_t>(pred));
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief The i'th item of the run buffer in sorted order.
+	///////////////////////////////////////////////////////////////////////////
+	store_type & at(array<store_type> & items, memory_size_type i) {
+		return items[i];
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Move the items of the run buffer into sorted order.
+	///////////////////////////////////////////////////////////////////////////
+	void permute(array<store_type> &, memory_size_type) {}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Forget the order computed by the last sort. Called when the
+	/// run buffer is emptied.
+	///////////////////////////////////////////////////////////////////////////
+	void clear() {}
+
+private:
+	bool m_stable;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Sorts the run buffer of merge_sorter through an array of
+/// (prefix, index) pairs, so that wide items are not moved while sorting.
+/// The items are visited in sorted order through at() when the run is
+/// written, or moved into order once by permute() when the run is reported
+/// internally.
+///////////////////////////////////////////////////////////////////////////////
+template <typename specific_store_t, typename pred_t>
+class run_sorter<specific_store_t, pred_t, true> {
+public:
+	typedef typename specific_store_t::store_type store_type;
+	typedef key_prefix<typename specific_store_t::element_type, pred_t> prefix_t;
+	typedef prefix_index<typename prefix_t::prefix_type> entry_type;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Extra memory per item used by a stable sort of the run buffer.
+	/// Ties are broken by index, so no extra memory is used.
+	///////////////////////////////////////////////////////////////////////////
+	static const memory_size_type stable_item_overhead = 0;
+
+	run_sorter(memory_bucket_ref bucket)
+		: m_keys(bucket)
+		, m_sorted(false)
+		, m_count(0)
+		, m_stable(false)
+	{
+	}
+
+	void resize(memory_size_type n) {
+		m_keys.resize(n);
+		m_sorted = false;
+	}
+
+	void set_stable(bool stable) {
+		m_stable = stable;
+	}
+
+	void sort(array<store_type> & items, memory_size_type n, pred_t pred) {
+		tp_assert(n <= m_keys.size(), "Run buffer larger than key array");
+		for (memory_size_type i = 0; i < n; ++i) {
+			m_keys[i].prefix = prefix_t::prefix(specific_store_t::store_as_element(items[i]));
+			m_keys[i].index = i;
+		}
+		parallel_sort(m_keys.begin(), m_keys.begin()+n,
+					  prefix_index_pred<pred_t, specific_store_t>(pred, items.get(), m_stable));
+		m_sorted = true;
+		m_count = n;
+	}
+
+	store_type & at(array<store_type> & items, memory_size_type i) {
+		return m_sorted ? items[m_keys[i].index] : items[i];
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Move the items of the run buffer into sorted order by following
+	/// the cycles of the permutation, so every item is moved at most twice.
+	///////////////////////////////////////////////////////////////////////////
+	void permute(array<store_type> & items, memory_size_type n) {
+		if (!m_sorted) return;
+		tp_assert(n == m_count, "Run buffer changed after sort");
+		for (memory_size_type i = 0; i < n; ++i) {
+			if (m_keys[i].index == i) continue;
+			store_type tmp = std::move(items[i]);
+			memory_size_type j = i;
+			while (m_keys[j].index != i) {
+				memory_size_type k = m_keys[j].index;
+				items[j] = std::move(items[k]);
+				m_keys[j].index = j;
+				j = k;
+			}
+			items[j] = std::move(tmp);
+			m_keys[j].index = j;
+		}
+		m_sorted = false;
+	}
+
+	void clear() {
+		m_sorted = false;
+	}
+
+private:
+	array<entry_type> m_keys;
+	bool m_sorted;
+	memory_size_type m_count;
+	bool m_stable;
+};
+
+} // namespace bits
+
+} // namespace tpie
+
+#endif // __TPIE_PIPELINING_KEY_PREFIX_H__
@@ -18,6 +18,9 @@
 // along with TPIE.  If not, see <http://www.gnu.org/licenses/>
 
 #include <tpie/pipelining/merge_sorter.h>
+#include <tpie/pipelining/sort_cost_model.h>
+#include <tpie/tpie.h>
+#include <filesystem>
 
 namespace tpie {
 
@@ -34,7 +37,7 @@ run_positions::~run_positions() {
 
 /*static*/ memory_size_type run_positions::memory_usage() noexcept {
 	return sizeof(run_positions)
-		+ 2 * file_stream<stream_position>::memory_usage();
+		+ 2 * file_stream<run_position>::memory_usage();
 }
 
 void run_positions::open() {
@@ -45,7 +48,7 @@ void run_positions::open() {
 	m_open = true;
 	m_final = m_evacuated = false;
 	m_finalExtraSet = false;
-	m_finalExtra = stream_position();
+	m_finalExtra = run_position();
 	m_finalPositions.resize(0);
 }
 
@@ -55,7 +58,7 @@ void run_positions::close() {
 		m_positions[1].close();
 		m_open = m_final = m_evacuated = false;
 		m_finalExtraSet = false;
-		m_finalExtra = stream_position();
+		m_finalExtra = run_position();
 		m_finalPositions.resize(0);
 	}
 }
@@ -120,7 +123,7 @@ void run_positions::final_level(memory_size_type fanout) {
 		throw exception("final_level: m_open == false");
 
 	m_final = true;
-	file_stream<stream_position> & s = m_positions[m_levels % 2];
+	file_stream<run_position> & s = m_positions[m_levels % 2];
 	if (fanout > s.size() - s.offset()) {
 		log_pipe_debug() << "Decrease final level fanout from " << fanout << " to ";
 		fanout = static_cast<memory_size_type>(s.size() - s.offset());
@@ -132,7 +135,7 @@ void run_positions::final_level(memory_size_type fanout) {
 	m_positions[1].close();
 }
 
-void run_positions::set_position(memory_size_type mergeLevel, memory_size_type runNumber, stream_position pos) {
+void run_positions::set_position(memory_size_type mergeLevel, memory_size_type runNumber, run_position pos) {
 	if (!m_open) open();
 
 	if (mergeLevel+1 != m_levels) {
@@ -144,7 +147,7 @@ void run_positions::set_position(memory_size_type mergeLevel, memory_size_type r
 		m_finalExtraSet = true;
 		return;
 	}
-	file_stream<stream_position> & s = m_positions[mergeLevel % 2];
+	file_stream<run_position> & s = m_positions[mergeLevel % 2];
 	memory_size_type & expectedRunNumber = m_runs[mergeLevel % 2];
 	if (runNumber != expectedRunNumber) {
 		throw exception("set_position: Wrong run number");
@@ -153,7 +156,7 @@ void run_positions::set_position(memory_size_type mergeLevel, memory_size_type r
 	s.write(pos);
 }
 
-stream_position run_positions::get_position(memory_size_type mergeLevel, memory_size_type runNumber) {
+run_position run_positions::get_position(memory_size_type mergeLevel, memory_size_type runNumber) {
 	if (!m_open) throw exception("get_position: !open");
 
 	if (m_final && mergeLevel+1 == m_levels) {
@@ -169,7 +172,7 @@ stream_position run_positions::get_position(memory_size_type mergeLevel, memory_
 	if (m_final) {
 		return m_finalPositions[runNumber];
 	}
-	file_stream<stream_position> & s = m_positions[mergeLevel % 2];
+	file_stream<run_position> & s = m_positions[mergeLevel % 2];
 	memory_size_type & expectedRunNumber = m_runs[mergeLevel % 2];
 	if (runNumber != expectedRunNumber) {
 		throw exception("get_position: Wrong run number");
@@ -188,24 +191,30 @@ void merge_sorter_base::set_parameters(memory_size_type runLength, memory_size_t
 	p.fanout = p.finalFanout = fanout;
 	m_parametersSet = true;
 	log_pipe_debug() << "Manually set merge sort run length and fanout\n";
-	log_pipe_debug() << "Run length =       " << p.runLength << " (uses memory " << (p.runLength*m_item_size + m_element_file_stream_memory_usage) << ")\n";
-	log_pipe_debug() << "Fanout =           " << p.fanout << " (uses memory " << m_fanout_memory_usage(p.fanout) << ")" << std::endl;
+	log_pipe_debug() << "Run length =       " << p.runLength << " (uses memory " << (p.runLength*run_item_size() + m_element_file_stream_memory_usage) << ")\n";
+	log_pipe_debug() << "Fanout =           " << p.fanout << " (uses memory " << merge_memory_usage(p.fanout) << ")" << std::endl;
 }
 
 
 merge_sorter_base::merge_sorter_base(
 	linear_memory_usage fanout_memory_usage,
 	memory_size_type item_size,
+	memory_size_type stable_item_size,
 	memory_size_type element_file_stream_memory_usage)
 	: m_fanout_memory_usage(fanout_memory_usage)
 	, m_item_size(item_size)
+	, m_stable_item_size(stable_item_size)
 	, m_element_file_stream_memory_usage(element_file_stream_memory_usage)
 	, m_bucketPtr(new memory_bucket())
 	, m_bucket(memory_bucket_ref(m_bucketPtr.get()))
 	, m_state(stNotStarted)
 	, p()
 	, m_parametersSet(false)
+	, m_costModel(false)
+	, m_stable(false)
+	, m_runCompression(compression_normal)
 	, m_maxItems(std::numeric_limits<stream_size_type>::max())
+	, m_limit(std::numeric_limits<stream_size_type>::max())
 	, m_evacuated(false)
 	, m_finalMergeInitialized(false)
 	, m_owning_node(nullptr)
@@ -295,9 +304,9 @@ void merge_sorter_base::calculate_parameters() {
 	// Fanout: determined by the size of our merge heap and the stream memory usage.
 	log_pipe_debug() << "Phase 2: " << p.memoryPhase2 << " b available memory\n";
 	p.fanout = calculate_fanout(p.memoryPhase2, p.filesPhase2);
-	if (m_fanout_memory_usage(p.fanout) > p.memoryPhase2) {
-		log_pipe_debug() << "Not enough memory for fanout " << p.fanout << "! (" << p.memoryPhase2 << " < " << m_fanout_memory_usage(p.fanout) << ")\n";
-		p.memoryPhase2 = m_fanout_memory_usage(p.fanout);
+	if (merge_memory_usage(p.fanout) > p.memoryPhase2) {
+		log_pipe_debug() << "Not enough memory for fanout " << p.fanout << "! (" << p.memoryPhase2 << " < " << merge_memory_usage(p.fanout) << ")\n";
+		p.memoryPhase2 = merge_memory_usage(p.fanout);
 	}
 	
 	// Phase 3 (final merge & report):
@@ -309,9 +318,9 @@ void merge_sorter_base::calculate_parameters() {
 	if (p.finalFanout > p.fanout)
 		p.finalFanout = p.fanout;
 	
-	if (m_fanout_memory_usage(p.finalFanout) > p.memoryPhase3) {
-		log_pipe_debug() << "Not enough memory for fanout " << p.finalFanout << "! (" << p.memoryPhase3 << " < " << m_fanout_memory_usage(p.finalFanout) << ")\n";
-		p.memoryPhase3 = m_fanout_memory_usage(p.finalFanout);
+	if (merge_memory_usage(p.finalFanout) > p.memoryPhase3) {
+		log_pipe_debug() << "Not enough memory for fanout " << p.finalFanout << "! (" << p.memoryPhase3 << " < " << merge_memory_usage(p.finalFanout) << ")\n";
+		p.memoryPhase3 = merge_memory_usage(p.finalFanout);
 	}
 	
 	// Phase 1 (run formation):
@@ -322,23 +331,25 @@ void merge_sorter_base::calculate_parameters() {
 	memory_size_type tempFileMemory = 2*p.fanout*sizeof(temp_file);
 	
 	log_pipe_debug() << "Phase 1: " << p.memoryPhase1 << " b available memory; " << streamMemory << " b for a single stream; " << tempFileMemory << " b for temp_files\n";
-	memory_size_type min_m1 = std::max(128*1024UL, 16*m_item_size) + bits::run_positions::memory_usage() + streamMemory + tempFileMemory;
+	memory_size_type min_m1 = std::max(128*1024UL, 16*run_item_size()) + bits::run_positions::memory_usage() + streamMemory + tempFileMemory;
 	if (p.memoryPhase1 < min_m1) {
 		log_warning() << "Not enough phase 1 memory for 128 KB items and an open stream! (" << p.memoryPhase1 << " < " << min_m1 << ")\n";
 		p.memoryPhase1 = min_m1;
 	}
-	p.runLength = (p.memoryPhase1 - bits::run_positions::memory_usage() - streamMemory - tempFileMemory)/m_item_size;
+	p.runLength = (p.memoryPhase1 - bits::run_positions::memory_usage() - streamMemory - tempFileMemory)/run_item_size();
 	
 	p.internalReportThreshold = (std::min(p.memoryPhase1,
 										  std::min(p.memoryPhase2,
 												   p.memoryPhase3))
-								 - tempFileMemory)/m_item_size;
+								 - tempFileMemory)/run_item_size();
 	if (p.internalReportThreshold > p.runLength)
 		p.internalReportThreshold = p.runLength;
 	
 	m_parametersSet = true;
 	
 	set_items(m_maxItems);
+
+	if (m_costModel) apply_cost_model();
 	
 	log_pipe_debug() << "Calculated merge sort parameters\n";
 	p.dump(log_pipe_debug());
@@ -367,6 +378,46 @@ void merge_sorter_base::calculate_parameters() {
 	}
 }
 
+void merge_sorter_base::apply_cost_model() {
+	if (m_maxItems == std::numeric_limits<stream_size_type>::max()) {
+		log_pipe_debug() << "Number of items unknown; the cost model only decides run compression" << std::endl;
+		return;
+	}
+	if (m_maxItems <= p.runLength) {
+		log_pipe_debug() << "All items fit in a single run; the cost model is not needed" << std::endl;
+		return;
+	}
+	sort_cost_model model(calibrated_sort_device_speeds(), m_item_size);
+	// The compression ratio is unknown until the first run has been written;
+	// assume compression does not pay off when choosing the merge tree.
+	sort_cost_estimate e = model.choose(m_maxItems, p.runLength, p.fanout, p.finalFanout, 1.0);
+	log_pipe_debug() << "Sort cost model: predicted "
+					 << model.predict(m_maxItems, p.runLength, p.fanout, p.finalFanout, true, 1.0)
+					 << " s with run length " << p.runLength << " and fanout " << p.fanout
+					 << "; predicted " << e.seconds << " s with run length " << e.runLength
+					 << ", fanout " << e.fanout << " and " << e.mergeLevels << " merge levels" << std::endl;
+	p.runLength = e.runLength;
+	p.fanout = e.fanout;
+	p.finalFanout = e.finalFanout;
+	if (p.internalReportThreshold > p.runLength)
+		p.internalReportThreshold = p.runLength;
+}
+
+void merge_sorter_base::choose_run_compression(stream_size_type items, memory_size_type elementSize) {
+	// The first run is in the first run file of merge level 0.
+	double bytes = static_cast<double>(items) * static_cast<double>(elementSize);
+	if (m_runCompression == compression_none || bytes < static_cast<double>(get_block_size())) return;
+	std::error_code ec;
+	std::uintmax_t fileSize = std::filesystem::file_size(m_runFiles[0].path(), ec);
+	if (ec) return;
+	double ratio = std::min(static_cast<double>(fileSize) / bytes, 1.0);
+	sort_cost_model model(calibrated_sort_device_speeds(), m_item_size);
+	if (!model.compress_runs(ratio)) m_runCompression = compression_none;
+	log_pipe_debug() << "First run compressed to " << ratio << " of its size; "
+					 << (m_runCompression == compression_none ? "not " : "")
+					 << "compressing the remaining runs" << std::endl;
+}
+
 memory_size_type merge_sorter_base::calculate_fanout(
 	memory_size_type availableMemory, memory_size_type availableFiles) noexcept {
 	memory_size_type fanout_lo = 2;
@@ -374,7 +425,7 @@ memory_size_type merge_sorter_base::calculate_fanout(
 	// binary search
 	while (fanout_lo < fanout_hi - 1) {
 		memory_size_type mid = fanout_lo + (fanout_hi-fanout_lo)/2;
-		if (m_fanout_memory_usage(mid) <= availableMemory) {
+		if (merge_memory_usage(mid) <= availableMemory) {
 			fanout_lo = mid;
 		} else {
 			fanout_hi = mid;
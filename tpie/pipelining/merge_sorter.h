@@ -24,6 +24,8 @@
 #include <tpie/compressed/stream.h>
 #include <tpie/pipelining/sort_parameters.h>
 #include <tpie/pipelining/merger.h>
+#include <tpie/pipelining/key_prefix.h>
+#include <tpie/pipelining/combiner.h>
 #include <tpie/pipelining/node.h>
 #include <tpie/pipelining/exception.h>
 #include <tpie/dummy_progress.h>
@@ -34,6 +36,16 @@ namespace tpie {
 
 namespace bits {
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Location and length of a sorted run in a run file.
+///////////////////////////////////////////////////////////////////////////////
+struct run_position {
+	/** Position of the first item of the run in its run file. */
+	stream_position position;
+	/** Number of items in the run. */
+	stream_size_type length;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief  Class to maintain the positions where sorted runs start.
 ///
@@ -58,6 +70,9 @@ namespace bits {
 /// lifted, but set_position may only be called with mergeLevel = d-1 and
 /// runNumber = 0. get_position may be called with mergeLevel = d-2 and any
 /// runNumber in any order.
+///
+/// Along with each position, the number of items in the run is stored, so
+/// runs need not have the same length.
 ///////////////////////////////////////////////////////////////////////////////
 class TPIE_EXPORT run_positions {
 public:
@@ -100,14 +115,14 @@ public:
 	void final_level(memory_size_type fanout);
 
 	///////////////////////////////////////////////////////////////////////////
-	/// Store a stream position - see class docstring.
+	/// Store a run position - see class docstring.
 	///////////////////////////////////////////////////////////////////////////
-	void set_position(memory_size_type mergeLevel, memory_size_type runNumber, stream_position pos);
+	void set_position(memory_size_type mergeLevel, memory_size_type runNumber, run_position pos);
 
 	///////////////////////////////////////////////////////////////////////////
-	/// Fetch a stream position - see class docstring.
+	/// Fetch a run position - see class docstring.
 	///////////////////////////////////////////////////////////////////////////
-	stream_position get_position(memory_size_type mergeLevel, memory_size_type runNumber);
+	run_position get_position(memory_size_type mergeLevel, memory_size_type runNumber);
 
 private:
 	/** Object state: Whether we are open. */
@@ -123,14 +138,14 @@ private:
 	memory_size_type m_runs[2];
 	temp_file m_positionsFile[2];
 	stream_position m_positionsPosition[2];
-	file_stream<stream_position> m_positions[2];
+	file_stream<run_position> m_positions[2];
 
-	/** If final: the stream positions in mergeLevel = d-2. */
-	array<stream_position> m_finalPositions;
+	/** If final: the run positions in mergeLevel = d-2. */
+	array<run_position> m_finalPositions;
 	/** If final: Whether the (d-1, 0)-position is stored. */
 	bool m_finalExtraSet;
 	/** If finalExtraSet: The (d-1, 0)-position. */
-	stream_position m_finalExtra;
+	run_position m_finalExtra;
 };
 
 } // namespace bits
@@ -140,6 +155,7 @@ public:
 	merge_sorter_base(
 		linear_memory_usage fanout_memory_usage,
 		memory_size_type item_size,
+		memory_size_type stable_item_size,
 		memory_size_type element_file_stream_memory_usage);
 
 	static const memory_size_type defaultFiles = 253; // Default number of files available, when not using set_available_files
@@ -204,6 +220,14 @@ public:
 		return m_itemCount;
 	}
 
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief The number of runs formed in phase 1. Zero when reporting
+	/// internally.
+	///////////////////////////////////////////////////////////////////////////
+	stream_size_type run_count() {
+		return m_finishedRuns;
+	}
+
 
 	memory_size_type evacuated_memory_usage() const {
 		return 2*p.fanout*sizeof(temp_file);
@@ -252,6 +276,59 @@ public:
 		check_not_started();
 	}
 
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Choose how the sorted runs are formed in phase 1.
+	///
+	/// Replacement selection uses the same memory as sorting the item buffer,
+	/// but forms runs of varying length that are twice as long on random
+	/// input and much longer on nearly sorted input.
+	///////////////////////////////////////////////////////////////////////////
+	void set_run_formation(run_formation_type t) {
+		p.runFormation = t;
+		check_not_started();
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Choose the sort parameters by predicted running time.
+	///
+	/// Without the cost model, the run length and fanout are the largest that
+	/// fit in memory, minimizing the number of merge levels. With the cost
+	/// model, they are chosen by \ref sort_cost_model from the comparison cost
+	/// and device speeds measured by \ref calibrated_sort_device_speeds, and
+	/// may be smaller when that is predicted to be faster. Since the number of
+	/// items must be known, this only applies after set_items.
+	/// Whether the runs are compressed is decided from the compression ratio
+	/// of the first run.
+	///////////////////////////////////////////////////////////////////////////
+	void set_cost_model(bool enabled) {
+		m_costModel = enabled;
+		check_not_started();
+	}
+
+	const sort_parameters & get_parameters() const {
+		return p;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Whether runs written from now on are compressed.
+	///////////////////////////////////////////////////////////////////////////
+	bool compresses_runs() const {
+		return m_runCompression != compression_none;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Only report the first k items in sorted order.
+	///
+	/// Runs are cut off after k items, and during run formation, items that
+	/// are known to come after the first k are discarded as soon as enough
+	/// sorted items have been written to runs.
+	///////////////////////////////////////////////////////////////////////////
+	void set_limit(stream_size_type k) {
+		tp_assert(k > 0, "Limit must be positive");
+		m_limit = k;
+		check_not_started();
+	}
+
 	bool is_calc_free() const {
 		tp_assert(m_state == stMerge, "Wrong phase");
 		return m_reportInternal || m_finishedRuns <= p.fanout;
@@ -273,11 +350,11 @@ public:
 	}
 
 	memory_size_type minimum_memory_phase_2() noexcept {
-		return m_fanout_memory_usage(calculate_fanout(0, 0));
+		return merge_memory_usage(calculate_fanout(0, 0));
 	}
 
 	memory_size_type minimum_memory_phase_3() noexcept {
-		return m_fanout_memory_usage(calculate_fanout(0, 0));
+		return merge_memory_usage(calculate_fanout(0, 0));
 	}
 
 	memory_size_type maximum_memory_phase_3() noexcept {
@@ -285,18 +362,18 @@ public:
 	}
 
 	memory_size_type phase_1_memory(const sort_parameters & params) noexcept {
-		return params.runLength * m_item_size
+		return params.runLength * run_item_size()
 			+ bits::run_positions::memory_usage()
 			+ m_element_file_stream_memory_usage
 			+ 2*params.fanout*sizeof(temp_file);
 	}
 
 	memory_size_type phase_2_memory(const sort_parameters & params) noexcept {
-		return m_fanout_memory_usage(params.fanout);
+		return merge_memory_usage(params.fanout);
 	}
 
 	memory_size_type phase_3_memory(const sort_parameters & params) noexcept {
-		return m_fanout_memory_usage(params.finalFanout);
+		return merge_memory_usage(params.finalFanout);
 	}
 	
 	///////////////////////////////////////////////////////////////////////////
@@ -311,6 +388,25 @@ protected:
 	///////////////////////////////////////////////////////////////////////////
 	void calculate_parameters();
 	
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief calculate_parameters helper: let the sort cost model choose
+	/// the run length and fanout.
+	///////////////////////////////////////////////////////////////////////////
+	void apply_cost_model();
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief With the cost model, decide whether to compress the remaining
+	/// runs from the size of the first run file.
+	///////////////////////////////////////////////////////////////////////////
+	void choose_run_compression(stream_size_type items, memory_size_type elementSize);
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Memory used per item of the run buffer in phase 1.
+	///////////////////////////////////////////////////////////////////////////
+	memory_size_type run_item_size() const noexcept {
+		return m_stable ? m_stable_item_size : m_item_size;
+	}
+
 	// Checks if we should still be able to change parameters
 	void check_not_started() {
 		if (m_state != stNotStarted) {
@@ -319,14 +415,11 @@ protected:
 	}
 
 	///////////////////////////////////////////////////////////////////////////
-	/// initialize_merger helper.
+	/// \brief Memory used by merging the given number of runs, including the
+	/// buffers that the merger reads blocks ahead into.
 	///////////////////////////////////////////////////////////////////////////
-	static stream_size_type calculate_run_length(stream_size_type initialRunLength, memory_size_type fanout, memory_size_type mergeLevel) {
-		stream_size_type runLength = initialRunLength;
-		for (memory_size_type i = 0; i < mergeLevel; ++i) {
-			runLength *= fanout;
-		}
-		return runLength;
+	memory_size_type merge_memory_usage(memory_size_type fanout) const noexcept {
+		return m_fanout_memory_usage(fanout) + bits::merger_prefetch_memory_usage(fanout);
 	}
 
 	enum state_type {
@@ -337,7 +430,7 @@ protected:
 	};
 
 	const linear_memory_usage m_fanout_memory_usage;
-    const memory_size_type m_item_size, m_element_file_stream_memory_usage;
+    const memory_size_type m_item_size, m_stable_item_size, m_element_file_stream_memory_usage;
 	
 	std::unique_ptr<memory_bucket> m_bucketPtr;
 	memory_bucket_ref m_bucket;
@@ -349,6 +442,13 @@ protected:
 	sort_parameters p;
 	bool m_parametersSet;
 
+	// Whether to choose parameters using sort_cost_model.
+	bool m_costModel;
+	// Whether equal items are reported in the order they were pushed.
+	bool m_stable;
+	// Compression of run files created from now on.
+	compression_flags m_runCompression;
+
 	bits::run_positions m_runPositions;
 
 	// Number of runs already written to disk.
@@ -360,6 +460,20 @@ protected:
 	// Used to index into m_currentRunItems, so memory_size_type.
 	memory_size_type m_currentRunItemCount;
 
+	// Length of the sorted prefix of the current run buffer. The buffer is
+	// sorted when this equals m_currentRunItemCount.
+	memory_size_type m_sortedPrefix;
+
+	// Whether a run file is open for writing in phase 1.
+	bool m_runOpen;
+
+	// Replacement selection: whether a run is being written from the heap.
+	bool m_selecting;
+	// Replacement selection: the first m_selectionItems items of
+	// m_currentRunItems form the heap of the run being written;
+	// the rest belong to the next run.
+	memory_size_type m_selectionItems;
+
 	bool m_reportInternal;
 
 	// When doing internal reporting: the number of items already reported
@@ -369,6 +483,11 @@ protected:
 	stream_size_type m_itemCount;
 
 	stream_size_type m_maxItems;
+
+	// Maximum number of items to report; see set_limit.
+	stream_size_type m_limit;
+	// Number of items reported from the final merge.
+	stream_size_type m_itemsReported;
 	
 	bool m_evacuated;
 	bool m_finalMergeInitialized;
@@ -401,61 +520,84 @@ private:
 	typedef typename specific_store_t::store_type store_type;
 	typedef typename specific_store_t::element_type element_type;	//Should be the same as TT
 	typedef outer_type item_type;
-	static const size_t item_size = specific_store_t::item_size;
+	static const size_t item_size = specific_store_t::item_size
+		+ bits::prefix_index_size<element_type, pred_t>::value;
+	typedef bits::sort_combiner<pred_t> combiner_t;
+	typedef bits::run_sorter<specific_store_t, pred_t> run_sorter_t;
 public:
 
 	typedef std::shared_ptr<merge_sorter> ptr;
 	typedef progress_types<UseProgress> Progress;
 	
 	merge_sorter(pred_t pred = pred_t(), store_t store = store_t())
-		: merge_sorter_base(fanout_memory_usage(), specific_store_t::item_size, file_stream<element_type>::memory_usage())
+		: merge_sorter_base(fanout_memory_usage(), item_size,
+							item_size + run_sorter_t::stable_item_overhead,
+							file_stream<element_type>::memory_usage())
 		, m_store(store.template get_specific<element_type>())
 		, m_merger(pred, m_store, m_bucket)
 		, m_currentRunItems(m_bucket)
+		, m_runSorter(m_bucket)
 		, pred(pred)
 		{}
 	
 
 public:
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Report equal items in the order they were pushed.
+	///
+	/// Runs are sorted with a stable sort, and the merges break ties by the
+	/// index of the input run, so no sequence number has to be stored with
+	/// the items. Replacement selection is not stable, so runs are always
+	/// formed by sorting the item buffer. Without key prefixes, the stable
+	/// sort needs a buffer of half the run, which shortens the runs.
+	///////////////////////////////////////////////////////////////////////////
+	void set_stable(bool stable) {
+		check_not_started();
+		m_stable = stable;
+		m_runSorter.set_stable(stable);
+		m_merger.set_stable(stable);
+	}
+
 	///////////////////////////////////////////////////////////////////////////
 	/// \brief Initiate phase 1: Formation of input runs.
 	///////////////////////////////////////////////////////////////////////////
 	void begin() {
 		tp_assert(m_state == stNotStarted, "Merge sorting already begun");
+		if (m_stable && p.runFormation == run_formation_replacement_selection) {
+			log_pipe_debug() << "Replacement selection is not stable; forming runs by sorting" << std::endl;
+			p.runFormation = run_formation_sort;
+		}
 		if (!m_parametersSet) calculate_parameters();
 		log_pipe_debug() << "Start forming input runs" << std::endl;
 		m_currentRunItems = array<store_type>(0, allocator<store_type>(m_bucket));
 		m_currentRunItems.resize((size_t)p.runLength);
+		m_runSorter.resize(p.runLength);
 		m_runFiles.resize(p.fanout*2);
 		m_currentRunItemCount = 0;
+		m_sortedPrefix = 0;
+		m_runOpen = false;
+		m_selecting = false;
 		m_finishedRuns = 0;
 		m_state = stRunFormation;
 		m_itemCount = 0;
+		m_itemsReported = 0;
+		m_hasThreshold = false;
+		m_checkpointCount = 0;
+		if (m_limit != std::numeric_limits<stream_size_type>::max()) {
+			m_checkpointStep = static_cast<memory_size_type>(std::max(m_limit / maxCheckpoints, stream_size_type(1)));
+			m_checkpoints.resize((m_limit + m_checkpointStep - 1) / m_checkpointStep);
+		}
 	}
 
 	///////////////////////////////////////////////////////////////////////////
 	/// \brief Push item to merge sorter during phase 1.
 	///////////////////////////////////////////////////////////////////////////
 	void push(item_type && item) {
-		tp_assert(m_state == stRunFormation, "Wrong phase");
-		if (m_currentRunItemCount >= p.runLength) {
-			sort_current_run();
-			empty_current_run();
-		}
-		m_currentRunItems[m_currentRunItemCount] = m_store.outer_to_store(std::move(item));
-		++m_currentRunItemCount;
-		++m_itemCount;
+		push_store(m_store.outer_to_store(std::move(item)));
 	}
 	
 	void push(const item_type & item) {
-		tp_assert(m_state == stRunFormation, "Wrong phase");
-		if (m_currentRunItemCount >= p.runLength) {
-			sort_current_run();
-			empty_current_run();
-		}
-		m_currentRunItems[m_currentRunItemCount] = m_store.outer_to_store(item);
-		++m_currentRunItemCount;
-		++m_itemCount;
+		push_store(m_store.outer_to_store(item));
 	}
 
 	///////////////////////////////////////////////////////////////////////////
@@ -463,27 +605,41 @@ public:
 	///////////////////////////////////////////////////////////////////////////
 	void end() {
 		tp_assert(m_state == stRunFormation, "Wrong phase");
+		if (m_selecting) end_selection();
 		sort_current_run();
+		if (!combiner_t::enabled && m_finishedRuns == 0 && !m_runOpen && m_currentRunItemCount > m_limit) {
+			// Only the first m_limit items will be reported.
+			m_runSorter.permute(m_currentRunItems, m_currentRunItemCount);
+			for (memory_size_type i = static_cast<memory_size_type>(m_limit); i < m_currentRunItemCount; ++i)
+				m_store.store_to_element(std::move(m_currentRunItems[i]));
+			m_currentRunItemCount = static_cast<memory_size_type>(m_limit);
+			m_sortedPrefix = m_currentRunItemCount;
+		}
 
 		if (m_itemCount == 0) {
 			tp_assert(m_currentRunItemCount == 0, "m_itemCount == 0, but m_currentRunItemCount != 0");
 			m_reportInternal = true;
 			m_itemsPulled = 0;
 			m_currentRunItems.resize(0);
+			m_runSorter.resize(0);
 			log_debug() << "Got no items. Internal reporting mode." << std::endl;
-		} else if (m_finishedRuns == 0 && m_currentRunItems.size() <= p.internalReportThreshold) {
+		} else if (m_finishedRuns == 0 && !m_runOpen && m_currentRunItems.size() <= p.internalReportThreshold) {
 			// Our current buffer fits within the memory requirements of phase 2.
+			m_runSorter.permute(m_currentRunItems, m_currentRunItemCount);
+			m_runSorter.resize(0);
 			m_reportInternal = true;
 			m_itemsPulled = 0;
 			log_debug() << "Got " << m_currentRunItemCount << " items. Internal reporting mode." << std::endl;
 
-		} else if (m_finishedRuns == 0
+		} else if (m_finishedRuns == 0 && !m_runOpen
 				   && m_currentRunItemCount <= p.internalReportThreshold
 				   && array<store_type>::memory_usage(m_currentRunItemCount) <= get_memory_manager().available()) {
 			// Our current buffer does not fit within the memory requirements
 			// of phase 2, but we have enough temporary memory to copy and
 			// resize the buffer.
 
+			m_runSorter.permute(m_currentRunItems, m_currentRunItemCount);
+			m_runSorter.resize(0);
 			array<store_type> currentRun(m_currentRunItemCount);
 			for (size_t i=0; i < m_currentRunItemCount; ++i)
 				currentRun[i] = std::move(m_currentRunItems[i]);
@@ -496,8 +652,10 @@ public:
 
 		} else {
 			m_reportInternal = false;
-			empty_current_run();
+			if (m_currentRunItemCount > 0) empty_current_run();
+			end_open_run();
 			m_currentRunItems.resize(0);
+			m_runSorter.resize(0);
 			log_debug() << "Got " << m_finishedRuns << " runs. External reporting mode." << std::endl;
 		}
 		m_state = stMerge;
@@ -527,6 +685,7 @@ public:
 			m_reportInternal = false;
 			memory_size_type runCount = (m_currentRunItemCount > 0) ? 1 : 0;
 			empty_current_run();
+			end_open_run();
 			m_currentRunItems.resize(0);
 			initialize_final_merger(0, runCount);
 		} else if (m_state == stMerge) {
@@ -553,23 +712,290 @@ private:
 	// Phase 1 helpers.
 	///////////////////////////////////////////////////////////////////////////
 
+	void push_store(store_type && el) {
+		tp_assert(m_state == stRunFormation, "Wrong phase");
+		if (m_hasThreshold && pred(m_threshold, specific_store_t::store_as_element(el))) {
+			// The item cannot be among the first m_limit items.
+			m_store.store_to_element(std::move(el));
+			return;
+		}
+		if (m_currentRunItemCount >= p.runLength) {
+			if (p.runFormation == run_formation_replacement_selection) {
+				push_selection(std::move(el));
+				++m_itemCount;
+				return;
+			}
+			sort_current_run();
+			empty_current_run();
+		}
+		m_currentRunItems[m_currentRunItemCount] = std::move(el);
+		check_sorted_order();
+		++m_currentRunItemCount;
+		++m_itemCount;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Sort the run buffer unless it is already sorted. If the sorted prefix
+	/// of the buffer continues the open run, it is appended to that run
+	/// first, and only the rest of the buffer is sorted to start a new run.
+	/// In this way, a sorted segment of the input that ends inside a buffer
+	/// still forms a single run.
+	///////////////////////////////////////////////////////////////////////////
 	void sort_current_run() {
-		parallel_sort(m_currentRunItems.begin(), m_currentRunItems.begin()+m_currentRunItemCount, 
-					  bits::store_pred<pred_t, specific_store_t>(pred));
+		if (m_sortedPrefix == m_currentRunItemCount) return;
+		bits::store_pred<pred_t, specific_store_t> less(pred);
+		if (m_runOpen && m_sortedPrefix > 0
+			&& !pred(specific_store_t::store_as_element(m_currentRunItems[0]), m_openRunLast)) {
+			if (m_finishedRuns < 10)
+				log_pipe_debug() << "Append " << m_sortedPrefix << " presorted items to run file " << m_finishedRuns << std::endl;
+			open_run_file_append(m_openRunFile, 0, m_finishedRuns);
+			write_current_run_items(0, m_sortedPrefix);
+			end_open_run();
+			std::move(m_currentRunItems.begin() + m_sortedPrefix,
+					  m_currentRunItems.begin() + m_currentRunItemCount,
+					  m_currentRunItems.begin());
+			m_currentRunItemCount -= m_sortedPrefix;
+		}
+		if (!std::is_sorted(m_currentRunItems.begin(), m_currentRunItems.begin()+m_currentRunItemCount, less))
+			m_runSorter.sort(m_currentRunItems, m_currentRunItemCount, pred);
+		m_sortedPrefix = m_currentRunItemCount;
 	}
 
-	// postcondition: m_currentRunItemCount = 0
+	///////////////////////////////////////////////////////////////////////////
+	/// Extend the sorted prefix of the run buffer if the item at index
+	/// m_currentRunItemCount, which has just been added, continues it.
+	///////////////////////////////////////////////////////////////////////////
+	void check_sorted_order() {
+		if (m_sortedPrefix == m_currentRunItemCount
+			&& (m_currentRunItemCount == 0
+				|| !bits::store_pred<pred_t, specific_store_t>(pred)(
+					m_currentRunItems[m_currentRunItemCount],
+					m_currentRunItems[m_currentRunItemCount-1])))
+			++m_sortedPrefix;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Write the sorted run buffer to disk. If its items all come after the
+	/// items of the open run, they are appended to that run; otherwise the
+	/// open run is closed and a new one is started. In this way, presorted
+	/// input is written as a single run, and input consisting of a few long
+	/// sorted segments gives one run per segment.
+	/// The run file is only kept open while the buffer is written, so phase 1
+	/// uses no stream memory between writes.
+	/// postcondition: m_currentRunItemCount = 0
+	///////////////////////////////////////////////////////////////////////////
 	void empty_current_run() {
-		if (m_finishedRuns < 10)
-			log_pipe_debug() << "Write " << m_currentRunItemCount << " items to run file " << m_finishedRuns << std::endl;
-		else if (m_finishedRuns == 10)
-			log_pipe_debug() << "..." << std::endl;
-		file_stream<element_type> fs;
-		open_run_file_write(fs, 0, m_finishedRuns);
-		for (memory_size_type i = 0; i < m_currentRunItemCount; ++i)
-			fs.write(m_store.store_to_element(std::move(m_currentRunItems[i])));
+		if (m_runOpen && m_currentRunItemCount > 0
+			&& pred(specific_store_t::store_as_element(m_currentRunItems[0]), m_openRunLast))
+			end_open_run();
+		if (!m_runOpen) {
+			if (m_finishedRuns < 10)
+				log_pipe_debug() << "Write " << m_currentRunItemCount << " items to run file " << m_finishedRuns << std::endl;
+			else if (m_finishedRuns == 10)
+				log_pipe_debug() << "..." << std::endl;
+			begin_open_run();
+		} else {
+			if (m_finishedRuns < 10)
+				log_pipe_debug() << "Append " << m_currentRunItemCount << " presorted items to run file " << m_finishedRuns << std::endl;
+			open_run_file_append(m_openRunFile, 0, m_finishedRuns);
+		}
+		if (m_currentRunItemCount > 0)
+			write_current_run_items(0, m_currentRunItemCount);
+		m_openRunFile.close();
 		m_currentRunItemCount = 0;
+		m_sortedPrefix = 0;
+		m_runSorter.clear();
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Write the items in [begin, end) of the sorted run buffer to the open
+	/// run file. With key prefixes, the items are written in the order
+	/// computed by m_runSorter, so they are only moved once.
+	/// Precondition: begin < end
+	///////////////////////////////////////////////////////////////////////////
+	void write_current_run_items(memory_size_type begin, memory_size_type end) {
+		if (combiner_t::enabled) {
+			write_combined_run_items(begin, end);
+			return;
+		}
+		if (m_limit != std::numeric_limits<stream_size_type>::max()) {
+			write_limited_run_items(begin, end);
+			return;
+		}
+		for (memory_size_type i = begin; i + 1 < end; ++i)
+			m_openRunFile.write(m_store.store_to_element(std::move(m_runSorter.at(m_currentRunItems, i))));
+		m_openRunLast = m_store.store_to_element(std::move(m_runSorter.at(m_currentRunItems, end-1)));
+		m_openRunFile.write(m_openRunLast);
+		m_openRunLength += end - begin;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Write the items in [begin, end) of the sorted run buffer to the open
+	/// run file, combining each group of equal items into one.
+	/// Precondition: begin < end
+	///////////////////////////////////////////////////////////////////////////
+	void write_combined_run_items(memory_size_type begin, memory_size_type end) {
+		element_type acc = m_store.store_to_element(std::move(m_runSorter.at(m_currentRunItems, begin)));
+		memory_size_type written = 0;
+		for (memory_size_type i = begin + 1; i < end; ++i) {
+			element_type x = m_store.store_to_element(std::move(m_runSorter.at(m_currentRunItems, i)));
+			if (!pred(acc, x)) {
+				acc = combiner_t::combine(pred, acc, x);
+			} else {
+				m_openRunFile.write(acc);
+				++written;
+				acc = std::move(x);
+			}
+		}
+		m_openRunFile.write(acc);
+		m_openRunLast = std::move(acc);
+		m_openRunLength += written + 1;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Write the items in [begin, end) of the sorted run buffer to the open
+	/// run file when only the first m_limit items are reported. Items past
+	/// the first m_limit of a run are dropped, and every m_checkpointStep'th
+	/// item of a run is offered as a checkpoint to tighten m_threshold.
+	/// Precondition: begin < end
+	///////////////////////////////////////////////////////////////////////////
+	void write_limited_run_items(memory_size_type begin, memory_size_type end) {
+		for (memory_size_type i = begin; i < end; ++i) {
+			element_type x = m_store.store_to_element(std::move(m_runSorter.at(m_currentRunItems, i)));
+			if (m_openRunLength >= m_limit) continue;
+			m_openRunFile.write(x);
+			++m_openRunLength;
+			if (m_openRunLength % m_checkpointStep == 0) add_checkpoint(x);
+			m_openRunLast = std::move(x);
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// A checkpoint is an item that has at least m_checkpointStep items of
+	/// its run at or before it. Once m_checkpoints holds enough checkpoints
+	/// to account for m_limit items, its largest checkpoint is an upper
+	/// bound on the m_limit'th item, and larger items are discarded in push.
+	///////////////////////////////////////////////////////////////////////////
+	void add_checkpoint(const element_type & x) {
+		auto less = [this](const element_type & a, const element_type & b) { return pred(a, b); };
+		if (m_checkpointCount < m_checkpoints.size()) {
+			m_checkpoints[m_checkpointCount++] = x;
+			std::push_heap(m_checkpoints.begin(), m_checkpoints.begin() + m_checkpointCount, less);
+		} else if (pred(x, m_checkpoints[0])) {
+			std::pop_heap(m_checkpoints.begin(), m_checkpoints.end(), less);
+			m_checkpoints[m_checkpointCount - 1] = x;
+			std::push_heap(m_checkpoints.begin(), m_checkpoints.end(), less);
+		} else {
+			return;
+		}
+		if (m_checkpointCount == m_checkpoints.size()) {
+			m_threshold = m_checkpoints[0];
+			m_hasThreshold = true;
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Open a new run for writing in phase 1.
+	///////////////////////////////////////////////////////////////////////////
+	void begin_open_run() {
+		m_openRunStart = open_run_file_write(m_openRunFile, 0, m_finishedRuns);
+		m_openRunLength = 0;
+		m_runOpen = true;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Close the run open for writing in phase 1, if any.
+	///////////////////////////////////////////////////////////////////////////
+	void end_open_run() {
+		if (!m_runOpen) return;
+		if (m_finishedRuns < 10)
+			log_pipe_debug() << "Run " << m_finishedRuns << " has " << m_openRunLength << " items" << std::endl;
+		if (m_openRunFile.is_open()) m_openRunFile.close();
+		close_run_file_write(0, m_finishedRuns, m_openRunStart, m_openRunLength);
+		if (m_costModel && m_finishedRuns == 0)
+			choose_run_compression(m_openRunLength, sizeof(element_type));
 		++m_finishedRuns;
+		m_runOpen = false;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Replacement selection: write the smallest item of the heap to the
+	/// current run and insert the given item in its place, either in the
+	/// heap or among the items saved for the next run.
+	/// Precondition: m_currentRunItemCount == p.runLength
+	///////////////////////////////////////////////////////////////////////////
+	void push_selection(store_type && el) {
+		if (!m_selecting) {
+			begin_selection_run(m_currentRunItemCount);
+		} else if (m_selectionItems == 0) {
+			end_open_run();
+			begin_selection_run(m_currentRunItemCount);
+		}
+		bits::store_pred<pred_t, specific_store_t> less(pred);
+		bool sameRun = !less(el, m_currentRunItems[0]);
+		m_openRunFile.write(m_store.store_to_element(std::move(m_currentRunItems[0])));
+		++m_openRunLength;
+		if (!sameRun) {
+			--m_selectionItems;
+			if (m_selectionItems > 0)
+				m_currentRunItems[0] = std::move(m_currentRunItems[m_selectionItems]);
+			m_currentRunItems[m_selectionItems] = std::move(el);
+		} else {
+			m_currentRunItems[0] = std::move(el);
+		}
+		if (m_selectionItems > 1) selection_sift_down();
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Replacement selection: open a new run file and build a heap of the
+	/// first n items in the buffer.
+	///////////////////////////////////////////////////////////////////////////
+	void begin_selection_run(memory_size_type n) {
+		bits::store_pred<pred_t, specific_store_t> less(pred);
+		std::make_heap(m_currentRunItems.begin(), m_currentRunItems.begin() + n,
+					   [&less](const store_type & a, const store_type & b) { return less(b, a); });
+		m_selectionItems = n;
+		begin_open_run();
+		m_selecting = true;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Replacement selection: write the rest of the heap to the current run
+	/// and leave the items of the next run at the start of the buffer.
+	///////////////////////////////////////////////////////////////////////////
+	void end_selection() {
+		parallel_sort(m_currentRunItems.begin(), m_currentRunItems.begin() + m_selectionItems,
+					  bits::store_pred<pred_t, specific_store_t>(pred));
+		for (memory_size_type i = 0; i < m_selectionItems; ++i)
+			m_openRunFile.write(m_store.store_to_element(std::move(m_currentRunItems[i])));
+		m_openRunLength += m_selectionItems;
+		end_open_run();
+		m_selecting = false;
+		for (memory_size_type i = m_selectionItems; i < m_currentRunItemCount; ++i)
+			m_currentRunItems[i - m_selectionItems] = std::move(m_currentRunItems[i]);
+		m_currentRunItemCount -= m_selectionItems;
+		m_sortedPrefix = std::min(m_currentRunItemCount, static_cast<memory_size_type>(1));
+		m_selectionItems = 0;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Replacement selection: restore the heap order after the smallest item
+	/// has been replaced.
+	///////////////////////////////////////////////////////////////////////////
+	void selection_sift_down() {
+		bits::store_pred<pred_t, specific_store_t> less(pred);
+		store_type el = std::move(m_currentRunItems[0]);
+		memory_size_type i = 0;
+		while (true) {
+			memory_size_type child = 2*i+1;
+			if (child >= m_selectionItems) break;
+			if (child+1 < m_selectionItems && less(m_currentRunItems[child+1], m_currentRunItems[child]))
+				++child;
+			if (!less(m_currentRunItems[child], el)) break;
+			m_currentRunItems[i] = std::move(m_currentRunItems[child]);
+			i = child;
+		}
+		m_currentRunItems[i] = std::move(el);
 	}
 
 	///////////////////////////////////////////////////////////////////////////
@@ -582,12 +1008,12 @@ private:
 
 		// Open files and seek to the first item in the run.
 		array<file_stream<element_type> > in(runCount);
+		array<stream_size_type> runLengths(runCount);
 		for (memory_size_type i = 0; i < runCount; ++i) {
-			open_run_file_read(in[i], mergeLevel, runNumber+i);
+			runLengths[i] = open_run_file_read(in[i], mergeLevel, runNumber+i);
 		}
-		stream_size_type runLength = calculate_run_length(p.runLength, p.fanout, mergeLevel);
 		// Pass file streams with correct stream offsets to the merger
-		m_merger.reset(in, runLength);
+		m_merger.reset(in, runLengths);
 	}
 
 	///////////////////////////////////////////////////////////////////////////
@@ -625,15 +1051,14 @@ public:
 		m_runPositions.unevacuate();
 		if (m_finalMergeSpecialRunNumber != std::numeric_limits<memory_size_type>::max()) {
 			array<file_stream<element_type> > in(p.finalFanout);
+			array<stream_size_type> runLengths(p.finalFanout);
 			for (memory_size_type i = 0; i < p.finalFanout-1; ++i) {
-				open_run_file_read(in[i], m_finalMergeLevel, i);
-				log_pipe_debug() << "Run " << i << " is at offset " << in[i].offset() << " and has size " << in[i].size() << std::endl;
+				runLengths[i] = open_run_file_read(in[i], m_finalMergeLevel, i);
+				log_pipe_debug() << "Run " << i << " is at offset " << in[i].offset() << " and has length " << runLengths[i] << std::endl;
 			}
-			open_run_file_read(in[p.finalFanout-1], m_finalMergeLevel+1, m_finalMergeSpecialRunNumber);
-			log_debug() << "Special large run is at offset " << in[p.finalFanout-1].offset() << " and has size " << in[p.finalFanout-1].size() << std::endl;
-			stream_size_type runLength = calculate_run_length(p.runLength, p.fanout, m_finalMergeLevel+1);
-			log_pipe_debug() << "Run length " << runLength << std::endl;
-			m_merger.reset(in, runLength);
+			runLengths[p.finalFanout-1] = open_run_file_read(in[p.finalFanout-1], m_finalMergeLevel+1, m_finalMergeSpecialRunNumber);
+			log_debug() << "Special large run is at offset " << in[p.finalFanout-1].offset() << " and has length " << runLengths[p.finalFanout-1] << std::endl;
+			m_merger.reset(in, runLengths);
 		} else {
 			initialize_merger(m_finalMergeLevel, 0, m_finalRunCount);
 		}
@@ -651,11 +1076,29 @@ private:
 		initialize_merger(mergeLevel, runNumber, runCount);
 		file_stream<element_type> out;
 		memory_size_type nextRunNumber = runNumber/p.fanout;
-		open_run_file_write(out, mergeLevel+1, nextRunNumber);
-		while (m_merger.can_pull()) {
-			pi.step();
-			out.write(m_store.store_to_element(m_merger.pull()));
+		stream_position start = open_run_file_write(out, mergeLevel+1, nextRunNumber);
+		stream_size_type length = 0;
+		if (combiner_t::enabled) {
+			while (m_merger.can_pull()) {
+				pi.step();
+				element_type acc = m_store.store_to_element(m_merger.pull());
+				while (m_merger.can_pull() && !pred(acc, specific_store_t::store_as_element(m_merger.peek()))) {
+					pi.step();
+					acc = combiner_t::combine(pred, acc, m_store.store_to_element(m_merger.pull()));
+				}
+				out.write(acc);
+				++length;
+			}
+		} else {
+			while (m_merger.can_pull() && length < m_limit) {
+				pi.step();
+				out.write(m_store.store_to_element(m_merger.pull()));
+				++length;
+			}
+			// Items past the first m_limit of the merged run are not needed.
+			m_merger.reset();
 		}
+		close_run_file_write(mergeLevel+1, nextRunNumber, start, length);
 		return nextRunNumber;
 	}
 
@@ -704,6 +1147,7 @@ public:
 	///////////////////////////////////////////////////////////////////////////
 	bool can_pull() {
 		tp_assert(m_state == stReport, "Wrong phase");
+		if (m_itemsReported >= m_limit) return false;
 		if (m_reportInternal) return m_itemsPulled < m_currentRunItemCount;
 		else {
 			if (m_evacuated) reinitialize_final_merger();
@@ -716,6 +1160,8 @@ public:
 	///////////////////////////////////////////////////////////////////////////
 	item_type pull() {
 		tp_assert(m_state == stReport, "Wrong phase");
+		++m_itemsReported;
+		if (combiner_t::enabled) return pull_combined();
 		if (m_reportInternal && m_itemsPulled < m_currentRunItemCount) {
 			store_type el = std::move(m_currentRunItems[m_itemsPulled++]);
 			if (!can_pull()) m_currentRunItems.resize(0);
@@ -723,11 +1169,40 @@ public:
 		} else {
 			if (m_evacuated) reinitialize_final_merger();
 			m_runPositions.close();
+			if (m_itemsReported == m_limit) {
+				// Drop the items that will not be reported.
+				item_type el = m_store.store_to_outer(m_merger.pull());
+				m_merger.reset();
+				return el;
+			}
 			return m_store.store_to_outer(m_merger.pull());
 		}
 	}
 
-	
+private:
+	///////////////////////////////////////////////////////////////////////////
+	/// pull() helper: fetch the next item and combine it with the equal items
+	/// that follow it.
+	///////////////////////////////////////////////////////////////////////////
+	item_type pull_combined() {
+		element_type acc;
+		if (m_reportInternal) {
+			acc = m_store.store_to_element(std::move(m_currentRunItems[m_itemsPulled++]));
+			while (m_itemsPulled < m_currentRunItemCount
+				   && !pred(acc, specific_store_t::store_as_element(m_currentRunItems[m_itemsPulled])))
+				acc = combiner_t::combine(pred, acc, m_store.store_to_element(std::move(m_currentRunItems[m_itemsPulled++])));
+			if (!can_pull()) m_currentRunItems.resize(0);
+		} else {
+			if (m_evacuated) reinitialize_final_merger();
+			m_runPositions.close();
+			acc = m_store.store_to_element(m_merger.pull());
+			while (m_merger.can_pull() && !pred(acc, specific_store_t::store_as_element(m_merger.peek())))
+				acc = combiner_t::combine(pred, acc, m_store.store_to_element(m_merger.pull()));
+		}
+		return m_store.store_to_outer(m_store.element_to_store(acc));
+	}
+
+public:
 	memory_size_type actual_memory_phase_3() {
 		tp_assert(m_state == stReport, "Wrong phase");
 		if (m_reportInternal)
@@ -750,7 +1225,7 @@ private:
 	}
 	
 	static constexpr memory_size_type fanout_memory_usage(memory_size_type fanout) noexcept {
-		return fanout_memory_usage()(fanout);
+		return fanout_memory_usage()(fanout) + bits::merger_prefetch_memory_usage(fanout);
 	}
 
  private:
@@ -768,26 +1243,50 @@ private:
 
 	///////////////////////////////////////////////////////////////////////////
 	/// \brief Open a new run file and seek to the end.
+	/// \returns The position of the first item of the run.
 	///////////////////////////////////////////////////////////////////////////
-	void open_run_file_write(file_stream<element_type> & fs, memory_size_type mergeLevel, memory_size_type runNumber) {
+	stream_position open_run_file_write(file_stream<element_type> & fs, memory_size_type mergeLevel, memory_size_type runNumber) {
 		// see run_file_index comment about runNumber
 
 		memory_size_type idx = run_file_index(mergeLevel, runNumber);
 		if (runNumber < p.fanout) m_runFiles[idx].free();
+		fs.open(m_runFiles[idx], access_read_write, 0, access_sequential, m_runCompression);
+		fs.seek(0, file_stream_base::end);
+		return fs.get_position();
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Reopen the run file of a run that is still being written and
+	/// seek to the end.
+	///////////////////////////////////////////////////////////////////////////
+	void open_run_file_append(file_stream<element_type> & fs, memory_size_type mergeLevel, memory_size_type runNumber) {
+		memory_size_type idx = run_file_index(mergeLevel, runNumber);
 		fs.open(m_runFiles[idx], access_read_write, 0, access_sequential, compression_normal);
 		fs.seek(0, file_stream_base::end);
-		m_runPositions.set_position(mergeLevel, runNumber, fs.get_position());
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Record the position and length of a run that has been written.
+	///////////////////////////////////////////////////////////////////////////
+	void close_run_file_write(memory_size_type mergeLevel, memory_size_type runNumber, stream_position start, stream_size_type length) {
+		bits::run_position pos;
+		pos.position = start;
+		pos.length = length;
+		m_runPositions.set_position(mergeLevel, runNumber, pos);
 	}
 
 	///////////////////////////////////////////////////////////////////////////
 	/// \brief Open an existing run file and seek to the correct offset.
+	/// \returns The number of items in the run.
 	///////////////////////////////////////////////////////////////////////////
-	void open_run_file_read(file_stream<element_type> & fs, memory_size_type mergeLevel, memory_size_type runNumber) {
+	stream_size_type open_run_file_read(file_stream<element_type> & fs, memory_size_type mergeLevel, memory_size_type runNumber) {
 		// see run_file_index comment about runNumber
 
 		memory_size_type idx = run_file_index(mergeLevel, runNumber);
 		fs.open(m_runFiles[idx], access_read, 0, access_sequential, compression_normal);
-		fs.set_position(m_runPositions.get_position(mergeLevel, runNumber));
+		bits::run_position pos = m_runPositions.get_position(mergeLevel, runNumber);
+		fs.set_position(pos.position);
+		return pos.length;
 	}
 
 	specific_store_t m_store;
@@ -796,6 +1295,28 @@ private:
 	// current run buffer. size 0 before begin(), size runLength after begin().
 	array<store_type> m_currentRunItems;
 
+	// Sorts the run buffer, through an array of key prefixes and indices
+	// if key_prefix is specialized for the item type.
+	bits::run_sorter<specific_store_t, pred_t> m_runSorter;
+
+	// The run file open for writing in phase 1, the position of its first
+	// item, the number of items written so far and the last item written
+	// from the run buffer.
+	file_stream<element_type> m_openRunFile;
+	stream_position m_openRunStart;
+	stream_size_type m_openRunLength;
+	element_type m_openRunLast;
+
+	// When reporting at most m_limit items: the checkpoints of the runs
+	// written so far, as a max-heap of at most maxCheckpoints items, and the
+	// resulting bound on the items that are still of interest.
+	static const memory_size_type maxCheckpoints = 64;
+	array<element_type> m_checkpoints;
+	memory_size_type m_checkpointCount;
+	memory_size_type m_checkpointStep;
+	bool m_hasThreshold;
+	element_type m_threshold;
+
 	pred_t pred;
 };
 
@@ -25,8 +25,33 @@
 #include <tpie/file_stream.h>
 #include <tpie/tpie_assert.h>
 #include <tpie/pipelining/store.h>
+#include <tpie/pipelining/key_prefix.h>
 namespace tpie {
 
+namespace bits {
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Number of extra stream buffers that a merger of the given number
+/// of runs reads blocks ahead into.
+///////////////////////////////////////////////////////////////////////////////
+inline memory_size_type merger_prefetch_buffers(memory_size_type runs) noexcept {
+	return runs / 4;
+}
+
+inline memory_size_type merger_prefetch_memory_usage(memory_size_type runs) noexcept {
+	return merger_prefetch_buffers(runs) * compressed_stream_base::block_memory_usage(1.0);
+}
+
+} // namespace bits
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Merges sorted runs stored in file streams.
+///
+/// The merger reads blocks ahead by forecasting: the run whose current block
+/// ends with the smallest item is the first to need its next block, so that
+/// block is read in the background into a pool of extra stream buffers,
+/// one for every four runs (see bits::merger_prefetch_buffers).
+///////////////////////////////////////////////////////////////////////////////
 template <typename specific_store_t, typename pred_t>
 class merger {
 private:
@@ -34,27 +59,60 @@ private:
 	typedef typename specific_store_t::element_type element_type;
 
 	typedef bits::store_pred<pred_t, specific_store_t> store_pred_t;
+	typedef bits::merge_heap_item<specific_store_t, pred_t> heap_item;
 public:
 	merger(pred_t pred, specific_store_t store,
 				  memory_bucket_ref bucket = memory_bucket_ref())
 		: pq(0, predwrap(store_pred_t(pred)), bucket)
 		, in(bucket)
-		, itemsRead(bucket)
-		, m_store(store) {
+		, itemsLeft(bucket)
+		, bufferedItems(bucket)
+		, prefetched(bucket)
+		, m_store(store)
+		, m_pred(pred)
+		, m_prefetchBuffers(0) {
+	}
+
+	~merger() {
+		reset();
 	}
 
 	bool can_pull() {
 		return !pq.empty();
 	}
 
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Break ties between equal items by the index of their input
+	/// run, so equal items are pulled in the order of their runs.
+	/// Precondition: !can_pull()
+	///////////////////////////////////////////////////////////////////////////
+	void set_stable(bool stable) {
+		tp_assert(pq.empty(), "set_stable while merging");
+		pq.get_comparator().set_stable(stable);
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief The item that the next call to pull() will return.
+	///////////////////////////////////////////////////////////////////////////
+	const store_type & peek() {
+		tp_assert(can_pull(), "peek() while !can_pull()");
+		return pq.top().item;
+	}
+
 	store_type pull() {
 		tp_assert(can_pull(), "pull() while !can_pull()");
-		store_type el = std::move(pq.top().first);
-		size_t i = pq.top().second;
-		if (in[i].can_read() && itemsRead[i] < runLength) {
+		store_type el = std::move(pq.top().item);
+		size_t i = pq.top().run;
+		if (in[i].can_read() && itemsLeft[i] > 0) {
+			// If the current block is used up, read() switches to the next.
+			bool nextBlock = bufferedItems[i] == 0;
 			pq.pop_and_push(
-				std::make_pair(m_store.element_to_store(in[i].read()), i));
-			++itemsRead[i];
+				heap_item(m_store.element_to_store(in[i].read()), i));
+			--itemsLeft[i];
+			if (nextBlock)
+				block_read(i);
+			else
+				--bufferedItems[i];
 		} else {
 			pq.pop();
 		}
@@ -67,7 +125,13 @@ public:
 	void reset() {
 		in.resize(0);
 		pq.resize(0);
-		itemsRead.resize(0);
+		itemsLeft.resize(0);
+		bufferedItems.resize(0);
+		prefetched.resize(0);
+		if (m_prefetchBuffers > 0) {
+			file_stream<element_type>::remove_prefetch_buffers(m_prefetchBuffers);
+			m_prefetchBuffers = 0;
+		}
 	}
 
 	// Initialize merger with given sorted input runs. Each file stream is
@@ -76,64 +140,144 @@ public:
 	// occurs earlier).
 	// Precondition: !can_pull()
 	void reset(array<file_stream<element_type> > & inputs, stream_size_type runLength) {
-		this->runLength = runLength;
+		array<stream_size_type> runLengths(inputs.size(), runLength);
+		reset(inputs, runLengths);
+	}
+
+	// Initialize merger with given sorted input runs of varying length.
+	// runLengths[i] items are read from the i'th stream (unless end of
+	// stream occurs earlier). Empty runs are skipped.
+	// Precondition: !can_pull()
+	void reset(array<file_stream<element_type> > & inputs, const array<stream_size_type> & runLengths) {
 		tp_assert(pq.empty(), "Reset before we are done");
+		tp_assert(inputs.size() == runLengths.size(), "Wrong number of run lengths");
 		in.swap(inputs);
 		pq.resize(in.size());
+		itemsLeft.resize(in.size());
+		bufferedItems.resize(in.size());
+		prefetched.resize(in.size());
 		for (size_t i = 0; i < in.size(); ++i) {
+			prefetched[i] = false;
+			if (runLengths[i] == 0 || !in[i].can_read()) {
+				itemsLeft[i] = 0;
+				bufferedItems[i] = 0;
+				continue;
+			}
 			pq.unsafe_push(
-				std::make_pair(
-					m_store.element_to_store(in[i].read()), i));
+				heap_item(m_store.element_to_store(in[i].read()), i));
+			itemsLeft[i] = runLengths[i] - 1;
+			bufferedItems[i] = in[i].buffered_items();
 		}
 		pq.make_safe();
-		itemsRead.resize(in.size(), 1);
+		if (!can_pull()) {
+			reset();
+			return;
+		}
+		m_prefetchBuffers = bits::merger_prefetch_buffers(in.size());
+		if (m_prefetchBuffers > 0) {
+			file_stream<element_type>::add_prefetch_buffers(m_prefetchBuffers);
+			prefetch();
+		}
 	}
 
-	// Compute memory usage as a function of the fanout
+	// Compute memory usage as a function of the fanout,
+	// not counting the prefetch buffers
 	static constexpr linear_memory_usage memory_usage() noexcept {
 		return
 			linear_memory_usage(-sizeof(file_stream<element_type>) //in filestreams,
 								+ file_stream<element_type>::memory_usage(), //in filestreams
 								sizeof(merger) 
-								- sizeof(internal_priority_queue<std::pair<store_type, size_t>, predwrap>) //pq
+								- sizeof(internal_priority_queue<heap_item, predwrap>) //pq
 								- sizeof(array<file_stream<element_type> >) //in
-								- sizeof(array<size_t>)) // itemsRead
-			+ array<size_t>::memory_usage() //itemsRead
-			+ internal_priority_queue<std::pair<store_type, size_t>, predwrap>::memory_usage() //pq
+								- 2*sizeof(array<stream_size_type>) // itemsLeft, bufferedItems
+								- sizeof(array<char>)) //prefetched
+			+ array<stream_size_type>::memory_usage() //itemsLeft
+			+ array<stream_size_type>::memory_usage() //bufferedItems
+			+ array<char>::memory_usage() //prefetched
+			+ internal_priority_queue<heap_item, predwrap>::memory_usage() //pq
 			+ array<file_stream<element_type> >::memory_usage(); //in
 	}
 	
 	
 	static constexpr memory_size_type memory_usage(memory_size_type fanout) noexcept {
-		return memory_usage()(fanout);
+		return memory_usage()(fanout) + bits::merger_prefetch_memory_usage(fanout);
 	}
 
 	class predwrap {
 	public:
-		typedef std::pair<store_type, size_t> item_type;
+		typedef heap_item item_type;
 		typedef item_type first_argument_type;
 		typedef item_type second_argument_type;
 		typedef bool result_type;
 
 		predwrap(store_pred_t pred)
 			: pred(pred)
+			, stable(false)
 		{
 		}
 
+		void set_stable(bool s) {
+			stable = s;
+		}
+
 		inline bool operator()(const item_type & lhs, const item_type & rhs) {
-			return pred(lhs.first, rhs.first);
+			if (heap_item::less(pred, lhs, rhs)) return true;
+			if (!stable || heap_item::less(pred, rhs, lhs)) return false;
+			return lhs.run < rhs.run;
 		}
 
 	private:
 		store_pred_t pred;
+		bool stable;
 	};
 
 private:
-	internal_priority_queue<std::pair<store_type, size_t>, predwrap> pq;
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Called when run i has read its next block.
+	///////////////////////////////////////////////////////////////////////////
+	void block_read(size_t i) {
+		bufferedItems[i] = in[i].buffered_items();
+		prefetched[i] = false;
+		// The previous block of the run is no longer needed, so there may be
+		// a free buffer to read ahead into.
+		if (m_prefetchBuffers > 0) prefetch();
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Read ahead the next blocks of the runs that will need them
+	/// first, while there are free buffers.
+	///
+	/// A run needs its next block when all items in its current block have
+	/// been merged, which happens before any other run needs a block if the
+	/// last item of its current block is the smallest.
+	///////////////////////////////////////////////////////////////////////////
+	void prefetch() {
+		while (true) {
+			size_t best = in.size();
+			for (size_t i = 0; i < in.size(); ++i) {
+				// Skip runs that end within their current block.
+				if (prefetched[i] || bufferedItems[i] == 0 || itemsLeft[i] <= bufferedItems[i])
+					continue;
+				if (best == in.size()
+					|| m_pred(in[i].last_buffered_item(), in[best].last_buffered_item()))
+					best = i;
+			}
+			if (best == in.size()) return;
+			if (!in[best].prefetch_next_block()) return;
+			prefetched[best] = true;
+		}
+	}
+
+	internal_priority_queue<heap_item, predwrap> pq;
 	array<file_stream<element_type> > in;
-	array<stream_size_type> itemsRead;
-	stream_size_type runLength;
+	array<stream_size_type> itemsLeft;
+	/** Number of items in the current block of each run after the item in pq. */
+	array<stream_size_type> bufferedItems;
+	/** Whether the block after the current one of each run is read ahead. */
+	array<char> prefetched;
 	specific_store_t m_store;
+	pred_t m_pred;
+	memory_size_type m_prefetchBuffers;
 };
 
 } // namespace tpie
@@ -0,0 +1,337 @@
+// -*- mode: c++; tab-width: 4; indent-tabs-mode: t; eval: (progn (c-set-style "stroustrup") (c-set-offset 'innamespace 0)); -*-
+// vi:set ts=4 sts=4 sw=4 noet :
+// Copyright 2026, The TPIE development team
+//
+// This file is part of TPIE.
+//
+// TPIE is free software: you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or (at your
+// option) any later version.
+//
+// TPIE is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with TPIE.  If not, see <http://www.gnu.org/licenses/>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \file partial_sort.h  Pipelining node reporting the k smallest items.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __TPIE_PIPELINING_PARTIAL_SORT_H__
+#define __TPIE_PIPELINING_PARTIAL_SORT_H__
+
+#include <tpie/pipelining/node.h>
+#include <tpie/pipelining/pipe_base.h>
+#include <tpie/pipelining/factory_base.h>
+#include <tpie/pipelining/merge_sorter.h>
+#include <tpie/array.h>
+#include <algorithm>
+#include <memory>
+
+namespace tpie::pipelining {
+namespace bits {
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief State shared by the input and output nodes of partial_sort.
+///
+/// If k items fit in the memory of both phases, the k smallest items seen
+/// so far are kept in a bounded max-heap, costing O(N log k) time and no
+/// I/O. Otherwise, a merge_sorter limited to k items is used, which cuts
+/// every run off after k items and discards items that are known to come
+/// after the first k during run formation.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename pred_t>
+class partial_sorter {
+public:
+	typedef T item_type;
+	typedef merge_sorter<T, true, pred_t> sorter_t;
+
+	partial_sorter(stream_size_type k, pred_t pred)
+		: m_k(k)
+		, m_pred(pred)
+		, m_sorter(std::make_shared<sorter_t>(pred))
+		, m_begun(false)
+		, m_useHeap(false)
+		, m_heapSize(0)
+		, m_pulled(0)
+		, m_memoryPhase1(0)
+		, m_memoryPhase3(0)
+	{
+		tp_assert(k > 0, "partial_sort of zero items");
+		m_sorter->set_limit(k);
+	}
+
+	memory_size_type heap_memory_usage() const {
+		return array<T>::memory_usage(static_cast<memory_size_type>(m_k));
+	}
+
+	sorter_t & sorter() {
+		return *m_sorter;
+	}
+
+	// Memory and file limits are only passed on before begin(), since the
+	// merge sorter fixes its parameters when it starts.
+	void set_phase_1_memory(memory_size_type m) {
+		if (m_begun) return;
+		m_memoryPhase1 = m;
+		m_sorter->set_phase_1_memory(m);
+	}
+
+	void set_phase_3_memory(memory_size_type m) {
+		if (m_begun) return;
+		m_memoryPhase3 = m;
+		m_sorter->set_phase_2_memory(m);
+		m_sorter->set_phase_3_memory(m);
+	}
+
+	void set_phase_1_files(memory_size_type f) {
+		if (!m_begun) m_sorter->set_phase_1_files(f);
+	}
+
+	void set_phase_3_files(memory_size_type f) {
+		if (m_begun) return;
+		m_sorter->set_phase_2_files(f);
+		m_sorter->set_phase_3_files(f);
+	}
+
+	void set_items(stream_size_type n) {
+		if (m_begun) return;
+		if (n < m_k) m_k = std::max(n, stream_size_type(1));
+		m_sorter->set_items(n);
+	}
+
+	void begin() {
+		m_begun = true;
+		m_useHeap = m_k <= std::numeric_limits<memory_size_type>::max()
+			&& heap_memory_usage() <= std::min(m_memoryPhase1, m_memoryPhase3);
+		if (m_useHeap) {
+			log_pipe_debug() << "partial_sort: keeping " << m_k << " items in a heap" << std::endl;
+			m_heap.resize(static_cast<memory_size_type>(m_k));
+			m_heapSize = 0;
+		} else {
+			log_pipe_debug() << "partial_sort: " << m_k << " items do not fit in memory; using a limited merge sort" << std::endl;
+			m_sorter->begin();
+		}
+	}
+
+	void push(const item_type & item) {
+		if (!m_useHeap) {
+			m_sorter->push(item);
+		} else if (m_heapSize < m_heap.size()) {
+			m_heap[m_heapSize++] = item;
+			std::push_heap(m_heap.begin(), m_heap.begin() + m_heapSize, m_pred);
+		} else if (m_pred(item, m_heap[0])) {
+			std::pop_heap(m_heap.begin(), m_heap.end(), m_pred);
+			m_heap[m_heapSize - 1] = item;
+			std::push_heap(m_heap.begin(), m_heap.end(), m_pred);
+		}
+	}
+
+	void end() {
+		if (m_useHeap) {
+			std::sort_heap(m_heap.begin(), m_heap.begin() + m_heapSize, m_pred);
+			m_pulled = 0;
+		} else {
+			m_sorter->end();
+		}
+	}
+
+	stream_size_type item_count() {
+		if (m_useHeap) return m_heapSize;
+		return std::min(m_sorter->item_count(), m_k);
+	}
+
+	void calc(progress_indicator_base & pi) {
+		if (m_useHeap) {
+			pi.init(1);
+			pi.step();
+			pi.done();
+		} else {
+			m_sorter->calc(pi);
+		}
+	}
+
+	bool can_pull() {
+		if (m_useHeap) return m_pulled < m_heapSize;
+		return m_sorter->can_pull();
+	}
+
+	item_type pull() {
+		if (m_useHeap) return m_heap[m_pulled++];
+		return m_sorter->pull();
+	}
+
+	void done() {
+		m_heap.resize(0);
+		m_sorter.reset();
+	}
+
+private:
+	stream_size_type m_k;
+	pred_t m_pred;
+	std::shared_ptr<sorter_t> m_sorter;
+	bool m_begun;
+	bool m_useHeap;
+	array<T> m_heap;
+	memory_size_type m_heapSize;
+	memory_size_type m_pulled;
+	memory_size_type m_memoryPhase1;
+	memory_size_type m_memoryPhase3;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Output node of partial_sort. Reports the k smallest items in
+/// sorted order in the phase after the input node.
+///////////////////////////////////////////////////////////////////////////////
+template <typename pred_t, typename dest_t>
+class partial_sort_output_t : public node {
+public:
+	typedef typename push_type<dest_t>::type item_type;
+	typedef partial_sorter<item_type, pred_t> sorter_t;
+
+	partial_sort_output_t(dest_t dest, std::shared_ptr<sorter_t> sorter, const node_token & input_token)
+		: m_sorter(sorter)
+		, dest(std::move(dest))
+	{
+		add_dependency(input_token);
+		add_push_destination(this->dest);
+		set_minimum_resource_usage(FILES, sorter_t::sorter_t::minimumFilesPhase3);
+		set_resource_fraction(FILES, 1.0);
+		set_minimum_memory(m_sorter->sorter().minimum_memory_phase_3());
+		set_memory_fraction(1.0);
+		set_name("Write top items", PRIORITY_INSIGNIFICANT);
+		set_plot_options(PLOT_BUFFERED);
+	}
+
+	void propagate() override {
+		forward("items", m_sorter->item_count());
+	}
+
+	void go() override {
+		progress_indicator_base * pi = proxy_progress_indicator();
+		m_sorter->calc(*pi);
+		while (m_sorter->can_pull()) dest.push(m_sorter->pull());
+	}
+
+	void end() override {
+		m_sorter->done();
+	}
+
+protected:
+	void resource_available_changed(resource_type type, memory_size_type available) override {
+		if (type == MEMORY)
+			m_sorter->set_phase_3_memory(available);
+		else if (type == FILES)
+			m_sorter->set_phase_3_files(available);
+	}
+
+private:
+	std::shared_ptr<sorter_t> m_sorter;
+	dest_t dest;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Input node of partial_sort.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename pred_t>
+class partial_sort_input_t : public node {
+public:
+	typedef T item_type;
+	typedef partial_sorter<item_type, pred_t> sorter_t;
+
+	partial_sort_input_t(std::shared_ptr<sorter_t> sorter, const node_token & token, std::shared_ptr<node> output)
+		: node(token)
+		, m_sorter(sorter)
+		, m_output(output)
+	{
+		set_name("Select top items", PRIORITY_SIGNIFICANT);
+		set_minimum_resource_usage(FILES, sorter_t::sorter_t::minimumFilesPhase1);
+		set_resource_fraction(FILES, 0.0);
+		set_minimum_memory(m_sorter->sorter().minimum_memory_phase_1());
+		set_memory_fraction(1.0);
+		set_plot_options(PLOT_BUFFERED | PLOT_SIMPLIFIED_HIDE);
+	}
+
+	void propagate() override {
+		if (can_fetch("items"))
+			m_sorter->set_items(fetch<stream_size_type>("items"));
+	}
+
+	void begin() override {
+		m_sorter->begin();
+	}
+
+	void push(const item_type & item) {
+		m_sorter->push(item);
+	}
+
+	void end() override {
+		m_sorter->end();
+	}
+
+protected:
+	void resource_available_changed(resource_type type, memory_size_type available) override {
+		if (type == MEMORY)
+			m_sorter->set_phase_1_memory(available);
+		else if (type == FILES)
+			m_sorter->set_phase_1_files(available);
+	}
+
+private:
+	std::shared_ptr<sorter_t> m_sorter;
+	std::shared_ptr<node> m_output;
+};
+
+template <typename pred_t>
+class partial_sort_factory : public factory_base {
+public:
+	template <typename dest_t>
+	using constructed_type = partial_sort_input_t<typename push_type<dest_t>::type, pred_t>;
+
+	partial_sort_factory(stream_size_type k, const pred_t & pred)
+		: m_k(k), m_pred(pred) {}
+
+	template <typename dest_t>
+	constructed_type<dest_t> construct(dest_t dest) {
+		typedef typename push_type<dest_t>::type item_type;
+		typedef partial_sorter<item_type, pred_t> sorter_t;
+		std::shared_ptr<sorter_t> sorter = std::make_shared<sorter_t>(m_k, m_pred);
+		node_token input_token;
+		std::shared_ptr<partial_sort_output_t<pred_t, dest_t> > output =
+			std::make_shared<partial_sort_output_t<pred_t, dest_t> >(std::move(dest), sorter, input_token);
+		this->init_sub_node(*output);
+		constructed_type<dest_t> input(sorter, input_token, output);
+		this->init_sub_node(input);
+		return input;
+	}
+
+private:
+	stream_size_type m_k;
+	pred_t m_pred;
+};
+
+} // namespace bits
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief A pipelining node that pushes the k smallest items under pred in
+/// sorted order and discards the rest, creating a phase boundary.
+///
+/// When k items fit in memory, this costs O(N log k) time and no I/O.
+/// Otherwise, a merge sort is used that never writes more than k items to
+/// a run and discards items during run formation once they are known not
+/// to be among the first k.
+///////////////////////////////////////////////////////////////////////////////
+template <typename pred_t=std::less<void> >
+inline pipe_middle<bits::partial_sort_factory<pred_t> >
+partial_sort(stream_size_type k, const pred_t & p=pred_t()) {
+	typedef bits::partial_sort_factory<pred_t> fact;
+	return pipe_middle<fact>(fact(k, p)).name("Partial sort");
+}
+
+} // namespace tpie::pipelining
+
+#endif // __TPIE_PIPELINING_PARTIAL_SORT_H__
@@ -399,11 +399,9 @@ public:
 	template <typename dest_t>
 	constructed_type<dest_t> construct(dest_t dest) {
 		using item_type = typename push_type<dest_t>::type;
-		sort_output_t<pred_t, dest_t, store_t> output(
-			std::move(dest),
-			std::make_shared<merge_sorter<item_type, true, pred_t, store_t> > (
-				m_pred,
-				m_store));
+		auto sorter = std::make_shared<merge_sorter<item_type, true, pred_t, store_t> >(m_pred, m_store);
+		if (m_stable) sorter->set_stable(true);
+		sort_output_t<pred_t, dest_t, store_t> output(std::move(dest), std::move(sorter));
 		this->init_sub_node(output);
 		sort_calc_t<item_type, pred_t, store_t> calc(std::move(output));
 		this->init_sub_node(calc);
@@ -412,10 +410,12 @@ public:
 		return input;
 	}
 
-	sort_factory(const pred_t & pred, store_t store): m_pred(pred), m_store(store) {}
+	sort_factory(const pred_t & pred, store_t store, bool stable = false)
+		: m_pred(pred), m_store(store), m_stable(stable) {}
 private:
 	pred_t m_pred;
 	store_t m_store;
+	bool m_stable;
 
 };
 
@@ -454,6 +454,34 @@ sort(const pred_t & p=std::less<void>(), store_t store=default_store()) {
 	return pipe_middle<fact>(fact(p, store)).name("Sort");
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief A pipelining node that sorts items and outputs equal items in the
+/// order they were pushed.
+///
+/// Stability costs no extra space per item; see merge_sorter::set_stable.
+///////////////////////////////////////////////////////////////////////////////
+template <typename pred_t=std::less<void> >
+inline pipe_middle<bits::sort_factory<pred_t, default_store> >
+stable_sort(const pred_t & p=std::less<void>()) {
+	typedef bits::sort_factory<pred_t, default_store> fact;
+	return pipe_middle<fact>(fact(p, default_store(), true)).name("Stable sort");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief A pipelining node that sorts items and combines each group of
+/// items that are equal under the predicate into a single item.
+///
+/// The associative combine function is applied when runs are formed, in
+/// every merge pass and in the final merge, so input with many duplicates
+/// shrinks on every pass over the data.
+///////////////////////////////////////////////////////////////////////////////
+template <typename pred_t, typename combine_t>
+inline pipe_middle<bits::sort_factory<combining_pred<pred_t, combine_t>, default_store> >
+combining_sort(const pred_t & p, const combine_t & combine) {
+	typedef bits::sort_factory<combining_pred<pred_t, combine_t>, default_store> fact;
+	return pipe_middle<fact>(fact(combining_pred<pred_t, combine_t>(p, combine), default_store())).name("Combining sort");
+}
+
 template <typename T, typename pred_t=std::less<T>, typename store_t=default_store>
 class passive_sorter;
 
@@ -0,0 +1,303 @@
+// -*- mode: c++; tab-width: 4; indent-tabs-mode: t; c-file-style: "stroustrup"; -*-
+// vi:set ts=4 sts=4 sw=4 noet :
+// Copyright 2026, The TPIE development team
+//
+// This file is part of TPIE.
+//
+// TPIE is free software: you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or (at your
+// option) any later version.
+//
+// TPIE is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with TPIE.  If not, see <http://www.gnu.org/licenses/>
+
+#include <tpie/pipelining/sort_cost_model.h>
+#include <tpie/array.h>
+#include <tpie/compressed/stream.h>
+#include <tpie/execution_time_predictor.h>
+#include <tpie/tempname.h>
+#include <tpie/tpie.h>
+#include <tpie/tpie_log.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace tpie {
+
+namespace {
+
+const memory_size_type cacheSortItems = 4096;
+const memory_size_type cacheSortRepetitions = 256;
+const memory_size_type memorySortItems = 1 << 21;
+const memory_size_type ioItems = 1 << 22;
+const memory_size_type interleavedStreams = 4;
+
+///////////////////////////////////////////////////////////////////////////////
+/// Run the benchmark and return its running time in milliseconds, unless the
+/// execution time database already holds a timing for it.
+///////////////////////////////////////////////////////////////////////////////
+time_type calibration_time(const std::string & id, stream_size_type n,
+						   const std::function<void()> & benchmark) {
+	execution_time_predictor predictor(id);
+	double confidence;
+	time_type t = predictor.estimate_execution_time(n, confidence);
+	if (t != static_cast<time_type>(-1) && confidence == 1.0)
+		return std::max(t, time_type(1));
+	predictor.start_execution(n);
+	auto start = std::chrono::steady_clock::now();
+	benchmark();
+	t = std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now() - start).count();
+	predictor.end_execution();
+	return std::max(t, time_type(1));
+}
+
+double seconds(time_type milliseconds) {
+	return static_cast<double>(milliseconds) / 1000.0;
+}
+
+void fill_random(array<uint64_t> & a, std::mt19937_64 & rng) {
+	for (size_t i = 0; i < a.size(); ++i) a[i] = rng();
+}
+
+void write_stream(temp_file & file, compression_flags compression, memory_size_type items) {
+	std::mt19937_64 rng(42);
+	file.free();
+	file_stream<uint64_t> fs;
+	fs.open(file, access_write, 0, access_sequential, compression);
+	for (memory_size_type i = 0; i < items; ++i) fs.write(rng());
+	fs.close();
+}
+
+void read_stream(temp_file & file) {
+	file_stream<uint64_t> fs;
+	fs.open(file, access_read);
+	uint64_t sum = 0;
+	while (fs.can_read()) sum += fs.read();
+	fs.close();
+	log_debug() << "Calibration checksum " << sum << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// Read an uncompressed stream block by block from a few positions in turn,
+/// like a merge reads its input runs.
+///////////////////////////////////////////////////////////////////////////////
+void read_interleaved(temp_file & file, memory_size_type items) {
+	memory_size_type blockItems = std::max(get_block_size() / sizeof(uint64_t), memory_size_type(1));
+	memory_size_type partItems = items / interleavedStreams;
+	array<file_stream<uint64_t> > fs(interleavedStreams);
+	for (memory_size_type j = 0; j < interleavedStreams; ++j) {
+		fs[j].open(file, access_read);
+		fs[j].seek(j * partItems);
+	}
+	uint64_t sum = 0;
+	for (memory_size_type begin = 0; begin < partItems; begin += blockItems) {
+		memory_size_type end = std::min(begin + blockItems, partItems);
+		for (memory_size_type j = 0; j < interleavedStreams; ++j)
+			for (memory_size_type i = begin; i < end; ++i) sum += fs[j].read();
+	}
+	for (memory_size_type j = 0; j < interleavedStreams; ++j) fs[j].close();
+	log_debug() << "Calibration checksum " << sum << std::endl;
+}
+
+sort_device_speeds measure_sort_device_speeds() {
+	sort_device_speeds s;
+	std::mt19937_64 rng(42);
+
+	{
+		array<uint64_t> a(cacheSortItems);
+		time_type t = calibration_time("tpie::sort_device_speeds::cache_sort", cacheSortItems * cacheSortRepetitions, [&]() {
+			for (memory_size_type r = 0; r < cacheSortRepetitions; ++r) {
+				fill_random(a, rng);
+				std::sort(a.begin(), a.end());
+			}
+		});
+		double comparisons = double(cacheSortRepetitions) * cacheSortItems * std::log2(double(cacheSortItems));
+		s.cacheComparison = seconds(t) / comparisons;
+		s.cacheBytes = double(cacheSortItems * sizeof(uint64_t));
+	}
+
+	{
+		array<uint64_t> a(memorySortItems);
+		time_type t = calibration_time("tpie::sort_device_speeds::memory_sort", memorySortItems, [&]() {
+			fill_random(a, rng);
+			std::sort(a.begin(), a.end());
+		});
+		double comparisons = double(memorySortItems) * std::log2(double(memorySortItems));
+		s.memoryComparison = seconds(t) / comparisons;
+		s.memoryBytes = double(memorySortItems * sizeof(uint64_t));
+	}
+
+	double bytes = double(ioItems * sizeof(uint64_t));
+	s.blockBytes = double(get_block_size());
+	temp_file file;
+	// Each benchmark writes the stream it reads, since any of them may be
+	// skipped when its timing is already in the database.
+	time_type sequential = calibration_time("tpie::sort_device_speeds::sequential_io", ioItems, [&]() {
+		write_stream(file, compression_none, ioItems);
+		read_stream(file);
+	});
+	time_type interleaved = calibration_time("tpie::sort_device_speeds::interleaved_io", ioItems, [&]() {
+		write_stream(file, compression_none, ioItems);
+		read_interleaved(file, ioItems);
+	});
+	time_type compressed = calibration_time("tpie::sort_device_speeds::compressed_io", ioItems, [&]() {
+		write_stream(file, compression_all, ioItems);
+		read_stream(file);
+	});
+	s.sequentialByte = seconds(sequential) / bytes;
+	s.compressionByte = seconds(compressed > sequential ? compressed - sequential : 0) / bytes;
+	time_type switches = interleaved > sequential ? interleaved - sequential : 0;
+	s.blockSwitch = seconds(switches) / std::max(bytes / s.blockBytes, 1.0);
+	return s;
+}
+
+} // unnamed namespace
+
+const sort_device_speeds & calibrated_sort_device_speeds() {
+	static const sort_device_speeds speeds = []() {
+		sort_device_speeds s = measure_sort_device_speeds();
+		s.dump(log_debug());
+		log_debug() << std::endl;
+		return s;
+	}();
+	return speeds;
+}
+
+sort_cost_model::sort_cost_model(const sort_device_speeds & speeds, memory_size_type itemSize)
+	: m_speeds(speeds)
+	, m_itemSize(static_cast<double>(itemSize))
+{
+}
+
+double sort_cost_model::comparison_cost(double bufferBytes) const {
+	if (bufferBytes <= m_speeds.cacheBytes) return m_speeds.cacheComparison;
+	if (bufferBytes >= m_speeds.memoryBytes) return m_speeds.memoryComparison;
+	double f = std::log(bufferBytes / m_speeds.cacheBytes)
+		/ std::log(m_speeds.memoryBytes / m_speeds.cacheBytes);
+	return m_speeds.cacheComparison + f * (m_speeds.memoryComparison - m_speeds.cacheComparison);
+}
+
+double sort_cost_model::io_cost(double bytes, bool compressRuns, double compressionRatio) const {
+	if (!compressRuns) return bytes * m_speeds.sequentialByte;
+	return bytes * (m_speeds.compressionByte + compressionRatio * m_speeds.sequentialByte);
+}
+
+double sort_cost_model::predict(stream_size_type items, memory_size_type runLength,
+								memory_size_type fanout, memory_size_type finalFanout,
+								bool compressRuns, double compressionRatio) const {
+	if (items == 0) return 0.0;
+	double n = static_cast<double>(items);
+	double bytes = n * m_itemSize;
+	runLength = std::max(runLength, memory_size_type(1));
+	fanout = std::max(fanout, memory_size_type(2));
+	finalFanout = std::max(std::min(finalFanout, fanout), memory_size_type(2));
+
+	double run = static_cast<double>(std::min(items, stream_size_type(runLength)));
+	double t = n * std::log2(std::max(run, 2.0)) * comparison_cost(run * m_itemSize);
+	stream_size_type runs = (items + runLength - 1) / runLength;
+	if (runs <= 1) return t;
+
+	double blocks = bytes * (compressRuns ? compressionRatio : 1.0) / m_speeds.blockBytes;
+	double pass = io_cost(bytes, compressRuns, compressionRatio);
+	// Forming runs writes every item once.
+	t += pass / 2;
+	while (runs > fanout) {
+		t += pass + blocks * m_speeds.blockSwitch
+			+ n * std::log2(double(fanout)) * m_speeds.memoryComparison;
+		runs = (runs + fanout - 1) / fanout;
+	}
+	if (runs > finalFanout) {
+		// Merge the smallest runs so that the final merge has finalFanout runs.
+		double merged = double(runs - finalFanout + 1);
+		double fraction = merged / double(runs);
+		t += fraction * (pass + blocks * m_speeds.blockSwitch
+						 + n * std::log2(merged) * m_speeds.memoryComparison);
+		runs = finalFanout;
+	}
+	// The final merge only reads.
+	t += pass / 2 + blocks * m_speeds.blockSwitch
+		+ n * std::log2(std::max(double(runs), 2.0)) * m_speeds.memoryComparison;
+	return t;
+}
+
+bool sort_cost_model::compress_runs(double compressionRatio) const {
+	double perByte = m_speeds.sequentialByte + m_speeds.blockSwitch / m_speeds.blockBytes;
+	return m_speeds.compressionByte + compressionRatio * perByte < perByte;
+}
+
+/*static*/ memory_size_type sort_cost_model::merge_levels(stream_size_type runs,
+														  memory_size_type fanout,
+														  memory_size_type finalFanout) {
+	if (runs <= 1) return 0;
+	memory_size_type levels = 1;
+	while (runs > fanout) {
+		runs = (runs + fanout - 1) / fanout;
+		++levels;
+	}
+	if (runs > finalFanout) ++levels;
+	return levels;
+}
+
+sort_cost_estimate sort_cost_model::choose(stream_size_type items, memory_size_type maxRunLength,
+										   memory_size_type maxFanout, memory_size_type maxFinalFanout,
+										   double compressionRatio) const {
+	const memory_size_type maximumFanoutCandidates = 1024;
+	const memory_size_type runLengthHalvings = 10;
+
+	maxRunLength = std::max(maxRunLength, memory_size_type(1));
+	maxFanout = std::max(maxFanout, memory_size_type(2));
+	maxFinalFanout = std::max(std::min(maxFinalFanout, maxFanout), memory_size_type(2));
+
+	// Candidate run lengths: the longest, the shortest giving the same number
+	// of runs, and repeated halvings of the longest.
+	std::vector<memory_size_type> runLengths;
+	runLengths.push_back(maxRunLength);
+	stream_size_type runs = (items + maxRunLength - 1) / maxRunLength;
+	if (runs > 1) {
+		runLengths.push_back(static_cast<memory_size_type>((items + runs - 1) / runs));
+		memory_size_type r = maxRunLength;
+		for (memory_size_type i = 0; i < runLengthHalvings && r > 1; ++i) {
+			r /= 2;
+			runLengths.push_back(r);
+		}
+	}
+
+	sort_cost_estimate best;
+	best.seconds = std::numeric_limits<double>::infinity();
+	for (memory_size_type runLength : runLengths) {
+		memory_size_type fanout = maxFanout;
+		while (fanout >= 2) {
+			memory_size_type finalFanout = std::min(fanout, maxFinalFanout);
+			for (int c = 0; c < 2; ++c) {
+				bool compress = (c == 0);
+				double t = predict(items, runLength, fanout, finalFanout, compress, compressionRatio);
+				if (t < best.seconds) {
+					best.runLength = runLength;
+					best.fanout = fanout;
+					best.finalFanout = finalFanout;
+					best.compressRuns = compress;
+					best.seconds = t;
+				}
+			}
+			// Past maximumFanoutCandidates, only the largest fanout is tried.
+			if (fanout > maximumFanoutCandidates) fanout = maximumFanoutCandidates;
+			else --fanout;
+		}
+	}
+	best.mergeLevels = merge_levels((items + best.runLength - 1) / best.runLength,
+									best.fanout, best.finalFanout);
+	return best;
+}
+
+} // namespace tpie
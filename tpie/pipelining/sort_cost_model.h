@@ -0,0 +1,153 @@
+// -*- mode: c++; tab-width: 4; indent-tabs-mode: t; eval: (progn (c-set-style "stroustrup") (c-set-offset 'innamespace 0)); -*-
+// vi:set ts=4 sts=4 sw=4 noet :
+// Copyright 2026, The TPIE development team
+//
+// This file is part of TPIE.
+//
+// TPIE is free software: you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or (at your
+// option) any later version.
+//
+// TPIE is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with TPIE.  If not, see <http://www.gnu.org/licenses/>
+
+#ifndef __TPIE_PIPELINING_SORT_COST_MODEL_H__
+#define __TPIE_PIPELINING_SORT_COST_MODEL_H__
+
+#include <tpie/tpie_export.h>
+#include <tpie/types.h>
+#include <iostream>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \file sort_cost_model.h  Predicted running time of an external merge sort
+/// from measured CPU and device speeds.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace tpie {
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Measured speeds of the machine that the sort cost model is based
+/// on. All costs are in seconds.
+///////////////////////////////////////////////////////////////////////////////
+struct sort_device_speeds {
+	/** Cost of a comparison when sorting a buffer of cacheBytes bytes. */
+	double cacheComparison;
+	/** Cost of a comparison when sorting a buffer of memoryBytes bytes. */
+	double memoryComparison;
+	/** Size of the buffer sorted to measure cacheComparison. */
+	double cacheBytes;
+	/** Size of the buffer sorted to measure memoryComparison. */
+	double memoryBytes;
+	/** Cost of writing a byte to an uncompressed stream and reading it back. */
+	double sequentialByte;
+	/** CPU cost of compressing a byte and decompressing it again. */
+	double compressionByte;
+	/** Extra cost of reading a block when interleaving reads from several
+	 * streams, as a merge does, compared to reading a single stream. */
+	double blockSwitch;
+	/** Size of a stream block. */
+	double blockBytes;
+
+	void dump(std::ostream & out) const {
+		out << "Sort device speeds\n"
+			<< "Comparison in cache:         " << cacheComparison << " s\n"
+			<< "Comparison in memory:        " << memoryComparison << " s\n"
+			<< "Sequential I/O per byte:     " << sequentialByte << " s\n"
+			<< "Compression per byte:        " << compressionByte << " s\n"
+			<< "Block switch:                " << blockSwitch << " s\n";
+	}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Measure the speeds used by the sort cost model.
+///
+/// The first call in a process runs a short benchmark of each speed, unless
+/// the execution time database (see \ref execution_time_predictor.h) already
+/// holds a timing for it from an earlier run. New timings are stored in the
+/// database, so the benchmark only runs the first time TPIE is used on a
+/// machine. Later calls return the same speeds.
+///////////////////////////////////////////////////////////////////////////////
+TPIE_EXPORT const sort_device_speeds & calibrated_sort_device_speeds();
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Merge sort parameters chosen by the sort cost model.
+///////////////////////////////////////////////////////////////////////////////
+struct sort_cost_estimate {
+	memory_size_type runLength;
+	memory_size_type fanout;
+	memory_size_type finalFanout;
+	/** Number of merge passes over the data, including the final merge. */
+	memory_size_type mergeLevels;
+	bool compressRuns;
+	/** Predicted running time in seconds. */
+	double seconds;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Predicts the running time of a merge sort and chooses the
+/// parameters that minimize it.
+///
+/// Forming runs costs the comparisons of sorting each run, where a
+/// comparison gets more expensive as the run buffer outgrows the cache, and
+/// writing the runs. Each merge level costs reading and writing all items,
+/// the comparisons of the merge heap and a block switch for every block
+/// read; the final merge only reads. With compression, each byte of I/O
+/// costs the compression CPU time plus the I/O of the compressed byte.
+///////////////////////////////////////////////////////////////////////////////
+class TPIE_EXPORT sort_cost_model {
+public:
+	sort_cost_model(const sort_device_speeds & speeds, memory_size_type itemSize);
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief  Predicted running time in seconds of sorting the given number
+	/// of items.
+	/// \param compressionRatio  Compressed size of the runs divided by their
+	/// uncompressed size.
+	///////////////////////////////////////////////////////////////////////////
+	double predict(stream_size_type items, memory_size_type runLength,
+				   memory_size_type fanout, memory_size_type finalFanout,
+				   bool compressRuns, double compressionRatio) const;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief  Choose the run length, fanout and compression with the least
+	/// predicted running time.
+	///
+	/// The run length and fanouts are at most the given ones, which are the
+	/// largest that fit in memory. On ties, longer runs and larger fanouts
+	/// are preferred.
+	///////////////////////////////////////////////////////////////////////////
+	sort_cost_estimate choose(stream_size_type items, memory_size_type maxRunLength,
+							  memory_size_type maxFanout, memory_size_type maxFinalFanout,
+							  double compressionRatio) const;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief  Whether compressing runs with the given compression ratio is
+	/// predicted to be faster than writing them uncompressed.
+	///////////////////////////////////////////////////////////////////////////
+	bool compress_runs(double compressionRatio) const;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief  The number of merge passes over the data needed to merge the
+	/// given number of runs, including the final merge.
+	///////////////////////////////////////////////////////////////////////////
+	static memory_size_type merge_levels(stream_size_type runs,
+										 memory_size_type fanout,
+										 memory_size_type finalFanout);
+
+private:
+	double comparison_cost(double bufferBytes) const;
+	double io_cost(double bytes, bool compressRuns, double compressionRatio) const;
+
+	sort_device_speeds m_speeds;
+	double m_itemSize;
+};
+
+} // namespace tpie
+
+#endif // __TPIE_PIPELINING_SORT_COST_MODEL_H__
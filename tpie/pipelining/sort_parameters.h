@@ -25,6 +25,18 @@
 
 namespace tpie {
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Strategy used by the merge sorters to form the initial sorted runs.
+///////////////////////////////////////////////////////////////////////////////
+enum run_formation_type {
+	/** Fill the item buffer, sort it and write it as a single run. */
+	run_formation_sort,
+	/** Keep the item buffer as a heap and repeatedly write out its smallest
+	 * item (replacement selection). On random input, runs are twice as long
+	 * as the buffer on average, and presorted input yields a single run. */
+	run_formation_replacement_selection
+};
+
 struct sort_parameters {
 	/** files available while forming sorted runs. */
 	memory_size_type filesPhase1;
@@ -51,6 +63,8 @@ struct sort_parameters {
 	memory_size_type fanout;
 	/** Fanout of merge tree during phase 3. Less or equal to fanout. */
 	memory_size_type finalFanout;
+	/** How the sorted runs are formed during phase 1. */
+	run_formation_type runFormation;
 
 	void dump(std::ostream & out) const {
 		out << "Merge sort parameters\n"
@@ -63,7 +77,8 @@ struct sort_parameters {
 			<< "Phase 3 files:               " << filesPhase3 << '\n'
 			<< "Phase 3 memory:              " << memoryPhase3 << '\n'
 			<< "Final merge level fanout:    " << finalFanout << '\n'
-			<< "Internal report threshold:   " << internalReportThreshold << '\n';
+			<< "Internal report threshold:   " << internalReportThreshold << '\n'
+			<< "Replacement selection:       " << (runFormation == run_formation_replacement_selection) << '\n';
 	}
 };
 
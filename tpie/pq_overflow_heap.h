@@ -52,6 +52,16 @@ public:
     ///////////////////////////////////////////////////////////////////////////
     void push(const T& x);
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Insert a range of elements into the priority queue and
+    /// restore the heap in linear time.
+    ///
+    /// \param start Start of the range.
+    /// \param end End of the range.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename IT>
+    void insert(const IT & start, const IT & end);
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief Remove the top element from the priority queue.
     ///////////////////////////////////////////////////////////////////////////
@@ -33,6 +33,13 @@ inline void pq_overflow_heap<T, Comparator>::push(const T& x) {
 	h.push(x);
 }
 
+template<typename T, typename Comparator>
+template<typename IT>
+inline void pq_overflow_heap<T, Comparator>::insert(const IT & start, const IT & end) {
+	assert(h.size() + static_cast<memory_size_type>(end - start) <= maxsize);
+	h.insert(start, end);
+}
+
 template<typename T, typename Comparator>
 inline void pq_overflow_heap<T, Comparator>::pop() {
 	assert(!empty());
@@ -119,6 +119,20 @@ public:
     /////////////////////////////////////////////////////////
     void push(const T& x);
 
+    /////////////////////////////////////////////////////////
+    ///
+    /// Insert a range of elements into the priority queue
+    ///
+    /// Large batches fill the insertion buffer in bulk and
+    /// are written to group 0 slots a full buffer at a
+    /// time. Small batches are pushed one at a time.
+    ///
+    /// \param begin Random access iterator to the first item
+    /// \param end Iterator past the last item
+    ///
+    /////////////////////////////////////////////////////////
+    template <typename IT> void push_batch(IT begin, IT end);
+
     /////////////////////////////////////////////////////////
     ///
     /// Remove the top element from the priority queue
@@ -166,6 +180,35 @@ public:
     /////////////////////////////////////////////////////////
     template <typename F> F pop_equals(F f);
 
+    /////////////////////////////////////////////////////////
+    ///
+    /// Pop up to count elements in ascending order and write
+    /// them to out. Runs of the deletion buffer are copied
+    /// out without per-element bookkeeping.
+    ///
+    /// \param out Output iterator receiving the elements
+    /// \param count Maximum number of elements to pop
+    ///
+    /// \return The output iterator past the last element
+    ///
+    /////////////////////////////////////////////////////////
+    template <typename OutputIterator>
+    OutputIterator pop_batch(OutputIterator out, stream_size_type count);
+
+    /////////////////////////////////////////////////////////
+    ///
+    /// Pop all elements that are not greater than bound in
+    /// ascending order and write them to out.
+    ///
+    /// \param out Output iterator receiving the elements
+    /// \param bound Largest element to pop
+    ///
+    /// \return The output iterator past the last element
+    ///
+    /////////////////////////////////////////////////////////
+    template <typename OutputIterator>
+    OutputIterator pop_batch_until(OutputIterator out, const T & bound);
+
 private:
     Comparator comp_;
     T dummy;
@@ -234,6 +277,9 @@ private:
     memory_size_type slot_max_size(slot_type slotid);
     void write_slot(slot_type slotid, T* arr, memory_size_type len);
     slot_type free_slot(group_type group);
+    void flush_insertion_buffer();
+    template <typename OutputIterator, typename F>
+    OutputIterator pop_run(OutputIterator out, stream_size_type count, F in_bound);
     void empty_group(group_type group);
     void fill_buffer();
     void fill_group_buffer(group_type group);
@@ -237,78 +237,80 @@ priority_queue<T, Comparator, OPQType>::~priority_queue() { // destructor
 }
 
 template <typename T, typename Comparator, typename OPQType>
-void priority_queue<T, Comparator, OPQType>::push(const T& x) {
+void priority_queue<T, Comparator, OPQType>::flush_insertion_buffer() {
+	// When the overflow priority queue (aka. insertion buffer) is full,
+	// insert its contents into a new slot in group 0.
+	//
+	// To maintain the heap invariant
+	//     deletion buffer <= group buffer 0 <= group 0 slots
+	// we bubble lesser elements from insertion buffer down into
+	// deletion buffer and group buffer 0.
 
-	if(opq->full()) {
-		// When the overflow priority queue (aka. insertion buffer) is full,
-		// insert its contents into a new slot in group 0.
-		//
-		// To maintain the heap invariant
-		//     deletion buffer <= group buffer 0 <= group 0 slots
-		// we bubble lesser elements from insertion buffer down into
-		// deletion buffer and group buffer 0.
+	slot_type slot = free_slot(0); // (if group 0 is full, we recursively empty group i
+	                               // by merging it into a slot in group i+1)
 
-		slot_type slot = free_slot(0); // (if group 0 is full, we recursively empty group i
-		                               // by merging it into a slot in group i+1)
+	assert(opq->sorted_size() == setting_m);
+	T* arr = opq->sorted_array();
 
-		assert(opq->sorted_size() == setting_m);
-		T* arr = opq->sorted_array();
+	// Bubble lesser elements down into deletion buffer
+	if(buffer_size > 0) {
 
-		// Bubble lesser elements down into deletion buffer
-		if(buffer_size > 0) {
+		// fetch insertion buffer
+		std::copy(&arr[0], &arr[0] + opq->sorted_size(), &mergebuffer[0]);
 
-			// fetch insertion buffer
-			std::copy(&arr[0], &arr[0] + opq->sorted_size(), &mergebuffer[0]);
+		// fetch deletion buffer
+		std::copy(&buffer[buffer_start], &buffer[buffer_start] + buffer_size, &mergebuffer[opq->sorted_size()]);
 
-			// fetch deletion buffer
-			std::copy(&buffer[buffer_start], &buffer[buffer_start] + buffer_size, &mergebuffer[opq->sorted_size()]);
+		// sort buffer elements
+		std::sort(mergebuffer.get(), mergebuffer.get()+(buffer_size+opq->sorted_size()), comp_);
 
-			// sort buffer elements
-			std::sort(mergebuffer.get(), mergebuffer.get()+(buffer_size+opq->sorted_size()), comp_);
+		// smaller elements go in deletion buffer
+		std::copy(mergebuffer.get(), mergebuffer.get() + buffer_size, buffer.get() + buffer_start);
 
-			// smaller elements go in deletion buffer
-			std::copy(mergebuffer.get(), mergebuffer.get() + buffer_size, buffer.get() + buffer_start);
+		// larger elements go in insertion buffer
+		std::copy(mergebuffer.get()+buffer_size, mergebuffer.get()+buffer_size + opq->sorted_size(), &arr[0]);
+	}
 
-			// larger elements go in insertion buffer
-			std::copy(mergebuffer.get()+buffer_size, mergebuffer.get()+buffer_size + opq->sorted_size(), &arr[0]);
-		}
+	// Bubble lesser elements down into group buffer 0
+	if(group_size(0)> 0) {
 
-		// Bubble lesser elements down into group buffer 0
-		if(group_size(0)> 0) {
+		// Merge insertion buffer and group buffer 0
+		assert(group_size(0)+opq->sorted_size() <= setting_m*2);
+		memory_size_type j = 0;
 
-			// Merge insertion buffer and group buffer 0
-			assert(group_size(0)+opq->sorted_size() <= setting_m*2);
-			memory_size_type j = 0;
+		// fetch gbuffer0
+		for(stream_size_type i = group_start(0); i < group_start(0)+group_size(0); i++) {
+			mergebuffer[j] = gbuffer0[static_cast<memory_size_type>(i%setting_m)];
+			++j;
+		}
 
-			// fetch gbuffer0
-			for(stream_size_type i = group_start(0); i < group_start(0)+group_size(0); i++) {
-				mergebuffer[j] = gbuffer0[static_cast<memory_size_type>(i%setting_m)];
-				++j;
-			}
+		// fetch insertion buffer
+		std::copy(&arr[0], &arr[0] + opq->sorted_size(), &mergebuffer[j]);
 
-			// fetch insertion buffer
-			std::copy(&arr[0], &arr[0] + opq->sorted_size(), &mergebuffer[j]);
+		// sort
+		std::sort(mergebuffer.get(), mergebuffer.get()+(group_size(0)+opq->sorted_size()), comp_);
 
-			// sort
-			std::sort(mergebuffer.get(), mergebuffer.get()+(group_size(0)+opq->sorted_size()), comp_);
+		// smaller elements go in gbuffer0
+		std::copy(mergebuffer.get(), mergebuffer.get() + static_cast<size_t>(group_size(0)), gbuffer0.get());
+		group_start_set(0,0);
 
-			// smaller elements go in gbuffer0
-			std::copy(mergebuffer.get(), mergebuffer.get() + static_cast<size_t>(group_size(0)), gbuffer0.get());
-			group_start_set(0,0);
+		// larger elements go in insertion buffer (actually a free group 0 slot)
+		std::copy(&mergebuffer[group_size(0)], &mergebuffer[group_size(0)] + opq->sorted_size(), &arr[0]);
+	}
 
-			// larger elements go in insertion buffer (actually a free group 0 slot)
-			std::copy(&mergebuffer[group_size(0)], &mergebuffer[group_size(0)] + opq->sorted_size(), &arr[0]);
-		}
+	// move insertion buffer (which has elements larger than all of
+	// gbuffer0 and deletion buffer) into a free group 0 slot
 
-		// move insertion buffer (which has elements larger than all of
-		// gbuffer0 and deletion buffer) into a free group 0 slot
+	write_slot(slot, arr, opq->sorted_size());
+	opq->sorted_pop();
 
-		write_slot(slot, arr, opq->sorted_size());
-		opq->sorted_pop();
+	// insertion buffer is now empty
+}
 
-		// insertion buffer is now empty
+template <typename T, typename Comparator, typename OPQType>
+void priority_queue<T, Comparator, OPQType>::push(const T& x) {
 
-	}
+	if(opq->full()) flush_insertion_buffer();
 
 	// insertion buffer is non-full. insert element.
 	opq->push(x);
@@ -318,6 +320,32 @@ void priority_queue<T, Comparator, OPQType>::push(const T& x) {
 #endif
 }
 
+template <typename T, typename Comparator, typename OPQType> template <typename IT>
+void priority_queue<T, Comparator, OPQType>::push_batch(IT begin, IT end) {
+	while(begin != end) {
+		if(opq->full()) flush_insertion_buffer();
+
+		// In the internal case the insertion buffer holds the entire queue.
+		memory_size_type n = static_cast<memory_size_type>(end - begin);
+		if(slot_state.size() != 0)
+			n = std::min(n, setting_m - static_cast<memory_size_type>(opq->size()));
+
+		if(n * 16 < opq->size()) {
+			// Rebuilding the heap costs more than pushing a few elements.
+			for(memory_size_type i = 0; i < n; ++i) opq->push(*begin++);
+		} else {
+			// A full insertion buffer is sorted and written to a slot by
+			// flush_insertion_buffer, so this is linear until then.
+			opq->insert(begin, begin + n);
+			begin += n;
+		}
+		m_size += n;
+	}
+#ifndef NDEBUG
+	validate();
+#endif
+}
+
 template <typename T, typename Comparator, typename OPQType>
 void priority_queue<T, Comparator, OPQType>::pop() {
 	if(empty()) {
@@ -398,6 +426,59 @@ F priority_queue<T, Comparator, OPQType>::pop_equals(F f) {
 	return f;
 }
 
+template <typename T, typename Comparator, typename OPQType> template <typename OutputIterator>
+OutputIterator priority_queue<T, Comparator, OPQType>::pop_batch(OutputIterator out, stream_size_type count) {
+	return pop_run(out, count, [](const T &) {return true;});
+}
+
+template <typename T, typename Comparator, typename OPQType> template <typename OutputIterator>
+OutputIterator priority_queue<T, Comparator, OPQType>::pop_batch_until(OutputIterator out, const T & bound) {
+	return pop_run(out, std::numeric_limits<stream_size_type>::max(),
+				   [&](const T & x) {return !comp_(bound, x);});
+}
+
+template <typename T, typename Comparator, typename OPQType> template <typename OutputIterator, typename F>
+OutputIterator priority_queue<T, Comparator, OPQType>::pop_run(OutputIterator out, stream_size_type count, F in_bound) {
+	while(count > 0 && !empty()) {
+		// Call top() to freshen deletion buffer (if empty) and min_in_buffer
+		const T & t = top();
+		if(!in_bound(t)) break;
+
+		if(!min_in_buffer) {
+			*out = t;
+			++out;
+			opq->pop();
+			--m_size;
+			--count;
+			continue;
+		}
+
+		// The deletion buffer is sorted, so every element up to the top of
+		// the insertion buffer can be popped in one go.
+		const bool opq_empty = opq->size() == 0;
+		memory_size_type n = 0;
+		while(n < buffer_size && n < count) {
+			const T & x = buffer[buffer_start + n];
+			if(!opq_empty && !comp_(x, opq->top())) break;
+			if(!in_bound(x)) break;
+			++n;
+		}
+		assert(n > 0);
+		out = std::copy(buffer.get() + buffer_start, buffer.get() + buffer_start + n, out);
+		buffer_start += n;
+		buffer_size -= n;
+		if(buffer_size == 0) {
+			buffer_start = 0;
+		}
+		m_size -= n;
+		count -= n;
+	}
+#ifndef NDEBUG
+	validate();
+#endif
+	return out;
+}
+
 template <typename T, typename Comparator, typename OPQType>
 void priority_queue<T, Comparator, OPQType>::dump() {
 	TP_LOG_DEBUG( "--------------------------------------------------------------" << "\n"
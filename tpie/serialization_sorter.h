@@ -20,8 +20,11 @@
 #ifndef TPIE_SERIALIZATION_SORTER_H
 #define TPIE_SERIALIZATION_SORTER_H
 
-#include <queue>
+#include <exception>
+#include <type_traits>
 #include <filesystem>
+#include <thread>
+#include <vector>
 
 #include <tpie/array.h>
 #include <tpie/array_view.h>
@@ -29,11 +32,14 @@
 #include <tpie/tpie_log.h>
 #include <tpie/stats.h>
 #include <tpie/parallel_sort.h>
+#include <tpie/job.h>
 
 #include <tpie/serialization2.h>
 #include <tpie/serialization_stream.h>
+#include <tpie/serialization_string_sort.h>
 
 #include <tpie/pipelining/node.h>
+#include <tpie/pipelining/sort_parameters.h>
 
 namespace tpie {
 
@@ -56,6 +62,14 @@ struct sort_parameters {
 	memory_size_type minimumItemSize;
 	/** Directory in which temporary files are stored. */
 	std::string tempDir;
+	/** How the sorted runs are formed during phase 1. */
+	run_formation_type runFormation;
+	/** Maximum number of groups of runs merged at once, or 0 for the number
+	 * of job threads. */
+	memory_size_type mergeWorkers;
+	/** Threads serializing a run in the background while the next run is
+	 * formed, or 0 to form and write runs on the pushing thread. */
+	memory_size_type runFormationWorkers;
 
 	void dump(std::ostream & out) const {
 		out << "Serialization merge sort parameters\n"
@@ -66,12 +80,15 @@ struct sort_parameters {
 			<< "Phase 3 files:               " << filesPhase3 << '\n'
 			<< "Phase 3 memory:              " << memoryPhase3 << '\n'
 			<< "Minimum item size:           " << minimumItemSize << '\n'
-			<< "Temporary directory:         " << tempDir << '\n';
+			<< "Temporary directory:         " << tempDir << '\n'
+			<< "Replacement selection:       " << (runFormation == run_formation_replacement_selection) << '\n'
+			<< "Merge workers:               " << mergeWorkers << '\n'
+			<< "Run formation workers:       " << runFormationWorkers << '\n';
 	}
 };
 
 template <typename T>
-void set_owner(memory_bucket_ref b, T & item) {
+memory_size_type owned_size(const T & item) {
 	memory_size_type serSize = serialized_size(item);
 
 	if (serSize > sizeof(T)) {
@@ -79,11 +96,18 @@ void set_owner(memory_bucket_ref b, T & item) {
 		serSize -= sizeof(T);
 	}
 
-	b->count += serSize;	
+	return serSize;
+}
+
+template <typename T>
+void set_owner(memory_bucket_ref b, T & item) {
+	b->count += owned_size(item);
 }
 
 template <typename T>
-void unset_owner(memory_bucket_ref /*b*/, T & /*item*/) {}
+void unset_owner(memory_bucket_ref b, T & item) {
+	b->count -= owned_size(item);
+}
 
 template <typename T, typename pred_t>
 class internal_sort {
@@ -97,9 +121,15 @@ class internal_sort {
 
 	bool m_full;
 
+	// Replacement selection: the first m_heapItems items of m_buffer form
+	// a heap of the run being written; the rest belong to the next run.
+	memory_size_type m_heapItems;
+
 	memory_bucket_ref m_buffer_bucket;
 	memory_bucket_ref m_item_bucket;
 
+	run_sorter<T, pred_t> m_runSorter;
+
 public:
 	internal_sort(memory_bucket_ref buffer_bucket, 
 				  memory_bucket_ref item_bucket,
@@ -109,16 +139,21 @@ public:
 		, m_largestItem(sizeof(T))
 		, m_pred(pred)
 		, m_full(false)
+		, m_heapItems(0)
 		, m_buffer_bucket(buffer_bucket)
 		, m_item_bucket(item_bucket)
+		, m_runSorter(buffer_bucket)
 	{
 	}
 
 	void begin(memory_size_type memAvail) {
-		m_buffer.resize(memAvail / sizeof(T) / 2);
+		memory_size_type bufferItems = memAvail / (sizeof(T) + run_sorter<T, pred_t>::extra_item_size()) / 2;
+		m_buffer.resize(bufferItems);
+		m_runSorter.resize(bufferItems);
 		m_items = 0;
 		m_largestItem = sizeof(T);
 		m_full = false;
+		m_heapItems = 0;
 		m_memForItems = memAvail - m_buffer_bucket->count;
 	}
 
@@ -152,10 +187,91 @@ public:
 		return true;
 	}
 
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Replacement selection: make a heap of all items in the buffer,
+	/// forming the next run.
+	///////////////////////////////////////////////////////////////////////////
+	void begin_selection() {
+		std::make_heap(m_buffer.get(), m_buffer.get() + m_items, heap_pred());
+		m_heapItems = m_items;
+		m_full = false;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Replacement selection: true if the current run has no more
+	/// items in the buffer.
+	///////////////////////////////////////////////////////////////////////////
+	bool selection_empty() const {
+		return m_heapItems == 0;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Replacement selection: remove and return the smallest item of
+	/// the current run.
+	///////////////////////////////////////////////////////////////////////////
+	T pop_selection() {
+		std::pop_heap(m_buffer.get(), m_buffer.get() + m_heapItems, heap_pred());
+		--m_heapItems;
+		T res = std::move(m_buffer[m_heapItems]);
+		// Fill the hole with the last item so the next run stays contiguous.
+		--m_items;
+		if (m_heapItems != m_items)
+			m_buffer[m_heapItems] = std::move(m_buffer[m_items]);
+		unset_owner(m_item_bucket, res);
+		m_full = false;
+		return res;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Replacement selection: insert an item into the current run or
+	/// save it for the next run.
+	/// \returns False if the item does not fit in the buffer.
+	///////////////////////////////////////////////////////////////////////////
+	bool push_selection(const T & item, bool currentRun) {
+		if (!push(item)) return false;
+		if (currentRun) {
+			if (m_heapItems != m_items - 1)
+				std::swap(m_buffer[m_heapItems], m_buffer[m_items - 1]);
+			++m_heapItems;
+			std::push_heap(m_buffer.get(), m_buffer.get() + m_heapItems, heap_pred());
+		}
+		return true;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Replacement selection: stop selecting and keep the items of
+	/// the next run in the buffer.
+	/// Precondition: selection_empty()
+	///////////////////////////////////////////////////////////////////////////
+	void end_selection() {
+		m_heapItems = 0;
+		m_full = false;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Exchange the buffer, its items and the memory buckets charged
+	/// for them with another sorter. The largest item size stays, since it
+	/// is tracked for all items pushed to this sorter.
+	///////////////////////////////////////////////////////////////////////////
+	void swap(internal_sort & other) {
+		m_buffer.swap(other.m_buffer);
+		std::swap(m_items, other.m_items);
+		std::swap(m_memForItems, other.m_memForItems);
+		std::swap(m_full, other.m_full);
+		std::swap(m_heapItems, other.m_heapItems);
+		std::swap(m_buffer_bucket, other.m_buffer_bucket);
+		std::swap(m_item_bucket, other.m_item_bucket);
+		m_runSorter.swap(other.m_runSorter);
+	}
+
 	memory_size_type get_largest_item_size() {
 		return m_largestItem;
 	}
 
+	memory_size_type item_count() const {
+		return m_items;
+	}
+
 	///////////////////////////////////////////////////////////////////////////
 	/// \brief  Get the serialized size of the items written.
 	///
@@ -185,12 +301,13 @@ public:
 	}
 
 	void shrink_buffer() {
+		m_runSorter.resize(0);
 		array<T> newBuffer(array_view<const T>(begin(), end()));
 		m_buffer.swap(newBuffer);
 	}
 
 	void sort() {
-		parallel_sort(m_buffer.get(), m_buffer.get() + m_items, m_pred);
+		m_runSorter.sort(m_buffer.get(), m_buffer.get() + m_items, m_pred);
 	}
 
 	const T * begin() const {
@@ -207,6 +324,7 @@ public:
 	void free() {
 		reset();
 		m_buffer.resize(0);
+		m_runSorter.resize(0);
 	}
 
 	///////////////////////////////////////////////////////////////////////////
@@ -218,8 +336,22 @@ public:
 			unset_owner(m_item_bucket, m_buffer[i]);
 		m_item_bucket->count = 0;
 		m_items = 0;
+		m_heapItems = 0;
 		m_full = false;
 	}
+
+private:
+	// std heap algorithms build max-heaps, so invert the predicate.
+	struct heap_pred_t {
+		pred_t m_pred;
+		bool operator()(const T & a, const T & b) const {
+			return m_pred(b, a);
+		}
+	};
+
+	heap_pred_t heap_pred() const {
+		return heap_pred_t{m_pred};
+	}
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -280,6 +412,7 @@ class file_handler {
 
 	std::string m_tempDir;
 
+public:
 	std::string run_file(size_t physicalIndex) {
 		if (m_tempDir.size() == 0) throw exception("run_file: temp dir is the empty string");
 		std::stringstream ss;
@@ -287,7 +420,6 @@ class file_handler {
 		return ss.str();
 	}
 
-public:
 	file_handler()
 		: m_fileOffset(0)
 		, m_nextLevelFileOffset(0)
@@ -323,6 +455,15 @@ public:
 		m_writer.serialize(v);
 	}
 
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Append items that have already been serialized to memory.
+	///////////////////////////////////////////////////////////////////////////
+	void write_serialized(const char * data, memory_size_type n) {
+		if (!m_writerOpen) throw exception("write_serialized: No writer open");
+		serialization_writer::serializer s(m_writer);
+		s.write(data, n);
+	}
+
 	void close_writer() {
 		if (!m_writerOpen) throw exception("close_writer: No writer open");
 		m_writer.close();
@@ -365,12 +506,14 @@ public:
 		return m_readers[idx].can_read();
 	}
 
-	T read(size_t idx) {
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Read the next item of a run into an existing item, reusing
+	/// the memory it owns when possible.
+	///////////////////////////////////////////////////////////////////////////
+	void read(size_t idx, T & res) {
 		if (m_readersOpen == 0) throw exception("read: no readers open");
 		if (m_readersOpen < idx) throw exception("read: index out of bounds");
-		T res;
 		m_readers[idx].unserialize(res);
-		return res;
 	}
 
 	void close_readers_and_delete() {
@@ -385,6 +528,38 @@ public:
 		m_readersOpen = 0;
 	}
 
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Reserve the next fanout runs of the current level and a run
+	/// file for their merged output, to be merged outside the file handler.
+	/// \param output Set to the physical index of the output run file.
+	/// \returns The physical index of the first input run file.
+	///////////////////////////////////////////////////////////////////////////
+	size_t reserve_group(size_t fanout, size_t & output) {
+		if (m_readersOpen != 0) throw exception("reserve_group: readers open");
+		if (m_writerOpen) throw exception("reserve_group: writer open");
+		if (fanout == 0) throw exception("reserve_group: fanout == 0");
+		if (remaining_runs() == 0) m_nextLevelFileOffset = m_nextFileOffset;
+		if (fanout > remaining_runs()) throw exception("reserve_group: fanout out of bounds");
+
+		size_t first = m_fileOffset;
+		m_fileOffset += fanout;
+		output = m_nextFileOffset++;
+		return first;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Delete the input runs of a group reserved with reserve_group()
+	/// and account for its output run.
+	///////////////////////////////////////////////////////////////////////////
+	void release_group(size_t first, const std::vector<stream_size_type> & inputSizes,
+					   size_t output, stream_size_type outputSize) {
+		increase_usage(output, outputSize);
+		for (size_t i = 0; i < inputSizes.size(); ++i) {
+			decrease_usage(first + i, inputSizes[i]);
+			std::filesystem::remove(run_file(first + i));
+		}
+	}
+
 	void move_last_reader_to_next_level() {
 		if (remaining_runs() != 1)
 			throw exception("move_last_reader_to_next_level: remaining_runs != 1");
@@ -425,74 +600,218 @@ private:
 	}
 };
 
-template <typename T, typename pred_t>
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Merges sorted runs with a loser tree over the current item of
+/// each run.
+///
+/// Items are deserialized directly into their slot in the tree and never
+/// copied in and out of a heap; a match compares the items of two slots.
+/// files_t must provide can_read(idx) and read(idx, item).
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename pred_t, typename files_t = file_handler<T> >
 class merger {
-	class mergepred_t {
-		pred_t m_pred;
-
-	public:
-		typedef std::pair<T, size_t> item_type;
-
-		mergepred_t(const pred_t & pred) : m_pred(pred) {}
-
-		// Used with std::priority_queue, so invert the original relation.
-		bool operator()(const item_type & a, const item_type & b) const {
-			return m_pred(b.first, a.first);
-		}
-	};
-
-	typedef typename mergepred_t::item_type item_type;
-
-	file_handler<T> & files;
+	files_t & files;
 	pred_t pred;
-	std::vector<serialization_reader> rd;
-	typedef std::priority_queue<item_type, std::vector<item_type>, mergepred_t> priority_queue_type;
-	priority_queue_type pq;
+	size_t m_fanout;
+	size_t m_winner;
+	std::vector<T> m_heads;
+	std::vector<bool> m_exhausted;
+	// Loser tree: node i in [1, fanout) stores the index of the run that lost
+	// the match in that node.
+	std::vector<size_t> m_loser;
 
 public:
-	merger(file_handler<T> & files, const pred_t & pred)
+	merger(files_t & files, const pred_t & pred)
 		: files(files)
 		, pred(pred)
-		, pq(mergepred_t(pred))
+		, m_fanout(0)
+		, m_winner(0)
 	{
 	}
 
 	// Assume files.open_readers(fanout) has just been called
 	void init(size_t fanout) {
-		rd.resize(fanout);
-		for (size_t i = 0; i < fanout; ++i)
-			push_from(i);
+		m_fanout = fanout;
+		m_heads.resize(fanout);
+		m_exhausted.assign(fanout, false);
+		m_loser.assign(fanout, 0);
+		for (size_t i = 0; i < fanout; ++i) read_from(i);
+
+		std::vector<size_t> winners(2 * fanout);
+		for (size_t i = 0; i < fanout; ++i) winners[fanout + i] = i;
+		for (size_t node = fanout - 1; node > 0; --node) {
+			size_t candidate = winners[2 * node];
+			m_loser[node] = winners[2 * node + 1];
+			play(node, candidate);
+			winners[node] = candidate;
+		}
+		m_winner = fanout == 1 ? 0 : winners[1];
 	}
 
 	bool empty() const {
-		return pq.empty();
+		return m_fanout == 0 || m_exhausted[m_winner];
 	}
 
 	const T & top() const {
-		return pq.top().first;
+		return m_heads[m_winner];
 	}
 
 	void pop() {
-		size_t idx = pq.top().second;
-		pq.pop();
-		push_from(idx);
+		size_t candidate = m_winner;
+		read_from(candidate);
+		for (size_t node = (m_fanout + candidate) / 2; node > 0; node /= 2)
+			play(node, candidate);
+		m_winner = candidate;
 	}
 
 	// files.close_readers_and_delete() should be called after this
 	void free() {
-		{
-			priority_queue_type tmp(pred);
-			std::swap(pq, tmp);
-		}
-		rd.resize(0);
+		std::vector<T>().swap(m_heads);
+		std::vector<bool>().swap(m_exhausted);
+		std::vector<size_t>().swap(m_loser);
+		m_fanout = 0;
+		m_winner = 0;
 	}
 
 private:
-	void push_from(size_t idx) {
+	void read_from(size_t idx) {
 		if (files.can_read(idx)) {
-			pq.push(std::make_pair(files.read(idx), idx));
+			files.read(idx, m_heads[idx]);
+		} else {
+			m_exhausted[idx] = true;
+			T empty;
+			std::swap(m_heads[idx], empty);
 		}
 	}
+
+	// Leave the winner of the candidate and the loser stored in the node in
+	// candidate, and store the loser in the node.
+	void play(size_t node, size_t & candidate) {
+		size_t & loser = m_loser[node];
+		if (m_exhausted[loser]) return;
+		if (m_exhausted[candidate] || pred(m_heads[loser], m_heads[candidate]))
+			std::swap(loser, candidate);
+	}
+};
+
+template <typename T, typename pred_t, typename files_t = file_handler<T> >
+using merger_type = typename std::conditional<
+	string_sort_traits<T, pred_t>::enabled,
+	lcp_merger<T, pred_t, files_t>,
+	merger<T, pred_t, files_t> >::type;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Merges one group of runs of a merge level into a new run, as a
+/// job that may run concurrently with the merging of other groups.
+///
+/// The runs and the output are reserved from the file handler and opened on
+/// the calling thread; only the merging itself runs in the job.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename pred_t>
+class group_merge : public job {
+public:
+	group_merge(file_handler<T> & files, size_t fanout, const pred_t & pred)
+		: m_files(files)
+		, m_pred(pred)
+		, m_readers(fanout)
+	{
+		m_first = files.reserve_group(fanout, m_output);
+		for (size_t i = 0; i < fanout; ++i)
+			m_readers[i].open(files.run_file(m_first + i));
+		m_writer.open(files.run_file(m_output));
+	}
+
+	void operator()() override {
+		try {
+			merger_type<T, pred_t, group_merge> m(*this, m_pred);
+			m.init(m_readers.size());
+			while (!m.empty()) {
+				m_writer.serialize(m.top());
+				m.pop();
+			}
+			m.free();
+		} catch (...) {
+			m_error = std::current_exception();
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Close the files of the group and delete its input runs. Call
+	/// after join().
+	///////////////////////////////////////////////////////////////////////////
+	void finish() {
+		std::vector<stream_size_type> inputSizes(m_readers.size());
+		for (size_t i = 0; i < m_readers.size(); ++i) {
+			inputSizes[i] = m_readers[i].file_size();
+			m_readers[i].close();
+		}
+		m_writer.close();
+		m_files.release_group(m_first, inputSizes, m_output, m_writer.file_size());
+		if (m_error) std::rethrow_exception(m_error);
+	}
+
+	bool can_read(size_t idx) {
+		return m_readers[idx].can_read();
+	}
+
+	void read(size_t idx, T & res) {
+		m_readers[idx].unserialize(res);
+	}
+
+private:
+	file_handler<T> & m_files;
+	pred_t m_pred;
+	array<serialization_reader> m_readers;
+	serialization_writer m_writer;
+	size_t m_first;
+	size_t m_output;
+	std::exception_ptr m_error;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Serializes a slice of a sorted run into memory, so that a run can
+/// be serialized by several workers and written in order afterwards.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class serialize_slice : public job {
+public:
+	class serializer {
+		std::vector<char> & m_out;
+
+	public:
+		serializer(std::vector<char> & out) : m_out(out) {}
+
+		void write(const char * const s, const memory_size_type n) {
+			m_out.insert(m_out.end(), s, s + n);
+		}
+	};
+
+	serialize_slice()
+		: m_begin(nullptr)
+		, m_end(nullptr)
+	{
+	}
+
+	void set_slice(const T * begin, const T * end) {
+		m_begin = begin;
+		m_end = end;
+		m_data.clear();
+	}
+
+	void operator()() override {
+		using tpie::serialize;
+		serializer s(m_data);
+		for (const T * i = m_begin; i != m_end; ++i) serialize(s, *i);
+	}
+
+	const std::vector<char> & data() const {
+		return m_data;
+	}
+
+private:
+	const T * m_begin;
+	const T * m_end;
+	std::vector<char> m_data;
 };
 
 } // namespace serialization_bits
@@ -509,19 +828,33 @@ private:
 	memory_bucket_ref m_buffer_bucket;
 	std::unique_ptr<memory_bucket> m_item_bucket_ptr;
 	memory_bucket_ref m_item_bucket;
+	// Buckets of the buffer that is written in the background
+	std::unique_ptr<memory_bucket> m_spare_buffer_bucket_ptr;
+	std::unique_ptr<memory_bucket> m_spare_item_bucket_ptr;
 	pipelining::node * m_owning_node;
 
 	sorter_state m_state;
 	serialization_bits::internal_sort<T, pred_t> m_sorter;
+	// Parallel run formation: the previous run, which is sorted and written
+	// by m_runWriter while items are pushed to m_sorter.
+	serialization_bits::internal_sort<T, pred_t> m_background;
+	std::thread m_runWriter;
+	std::exception_ptr m_runWriterError;
 	serialization_bits::sort_parameters m_params;
 	bool m_parametersSet;
 	serialization_bits::file_handler<T> m_files;
-	serialization_bits::merger<T, pred_t> m_merger;
+	serialization_bits::merger_type<T, pred_t> m_merger;
+	pred_t m_pred;
 
 	stream_size_type m_items;
+	stream_size_type m_runCount;
+	memory_size_type m_concurrentMerges;
 	bool m_reportInternal;
 	const T * m_nextInternalItem;
 
+	// Replacement selection: whether a run is being written from the heap.
+	bool m_selecting;
+
 	static const memory_size_type defaultFiles = 253; // Default number of files available, when not using set_available_files
 	static const memory_size_type minimumFilesPhase1 = 1;
 	static const memory_size_type maximumFilesPhase1 = 1;
@@ -538,15 +871,23 @@ public:
 		, m_buffer_bucket(memory_bucket_ref(m_buffer_bucket_ptr.get()))
 		, m_item_bucket_ptr(new memory_bucket())
 		, m_item_bucket(memory_bucket_ref(m_item_bucket_ptr.get()))
+		, m_spare_buffer_bucket_ptr(new memory_bucket())
+		, m_spare_item_bucket_ptr(new memory_bucket())
 		, m_owning_node(nullptr)
 		, m_state(state_initial)
 		, m_sorter(m_buffer_bucket, m_item_bucket, pred)
+		, m_background(memory_bucket_ref(m_spare_buffer_bucket_ptr.get()),
+					   memory_bucket_ref(m_spare_item_bucket_ptr.get()), pred)
 		, m_parametersSet(false)
 		, m_files()
 		, m_merger(m_files, pred)
+		, m_pred(pred)
 		, m_items(0)
+		, m_runCount(0)
+		, m_concurrentMerges(1)
 		, m_reportInternal(false)
 		, m_nextInternalItem(0)
+		, m_selecting(false)
 	{
 		m_params.filesPhase1 = 0;
 		m_params.filesPhase2 = 0;
@@ -555,6 +896,13 @@ public:
 		m_params.memoryPhase2 = 0;
 		m_params.memoryPhase3 = 0;
 		m_params.minimumItemSize = minimumItemSize;
+		m_params.runFormation = run_formation_sort;
+		m_params.mergeWorkers = 0;
+		m_params.runFormationWorkers = 0;
+	}
+
+	~serialization_sorter() {
+		if (m_runWriter.joinable()) m_runWriter.join();
 	}
 
 private:
@@ -630,6 +978,44 @@ public:
 		set_phase_3_memory(m3);
 	}
 
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Choose how the sorted runs are formed in phase 1.
+	///
+	/// With replacement selection, the item buffer is kept as a heap, and the
+	/// run file stays open while items are pushed.
+	///////////////////////////////////////////////////////////////////////////
+	void set_run_formation(run_formation_type t) {
+		m_params.runFormation = t;
+		check_not_started();
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Set the maximum number of groups of runs merged at once within
+	/// a merge level. Defaults to the number of job threads.
+	///
+	/// Groups are only merged concurrently when the merge memory and files
+	/// can be split between them without adding a merge level.
+	///////////////////////////////////////////////////////////////////////////
+	void set_merge_workers(memory_size_type workers) {
+		m_params.mergeWorkers = workers;
+		check_not_started();
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Form runs in parallel with the given number of workers, or on
+	/// the pushing thread if zero (the default).
+	///
+	/// The run formation memory is split between two buffers. While items
+	/// are pushed to one, the run in the other is sorted and written by a
+	/// background thread, and with more than one worker, its serialization
+	/// is split across job threads. Runs are half as long as with a single
+	/// buffer. Ignored with replacement selection.
+	///////////////////////////////////////////////////////////////////////////
+	void set_run_formation_workers(memory_size_type workers) {
+		m_params.runFormationWorkers = workers;
+		check_not_started();
+	}
+
 	static memory_size_type minimum_memory_phase_1() {
 		return serialization_writer::memory_usage()*2;
 	}
@@ -656,11 +1042,15 @@ public:
 		if (m_owning_node != nullptr) {
 			m_buffer_bucket_ptr = std::move(m_owning_node->bucket(0));
 			m_item_bucket_ptr = std::move(m_owning_node->bucket(1));
+			m_spare_buffer_bucket_ptr = std::move(m_owning_node->bucket(2));
+			m_spare_item_bucket_ptr = std::move(m_owning_node->bucket(3));
 		}
 
 		if (n != nullptr) {
 			n->bucket(0) = std::move(m_buffer_bucket_ptr);
 			n->bucket(1) = std::move(m_item_bucket_ptr);
+			n->bucket(2) = std::move(m_spare_buffer_bucket_ptr);
+			n->bucket(3) = std::move(m_spare_item_bucket_ptr);
 		}
 
 		m_owning_node = n;
@@ -761,7 +1151,20 @@ public:
 
 		log_debug() << "Before begin; mem usage = "
 			<< get_memory_manager().used() << std::endl;
-		m_sorter.begin(m_params.memoryPhase1 - serialization_writer::memory_usage());
+		memory_size_type memForSorter = m_params.memoryPhase1 - serialization_writer::memory_usage();
+		if (parallel_run_formation()) {
+			// Keep room for the serialized slices of a run besides the two
+			// buffers, using fewer workers if they do not fit.
+			memory_size_type workers = m_params.runFormationWorkers;
+			while (workers > 1 && workers * slice_size() >= memForSorter / 2)
+				--workers;
+			m_params.runFormationWorkers = workers;
+			if (workers > 1) memForSorter -= workers * slice_size();
+			m_sorter.begin(memForSorter / 2);
+			m_background.begin(memForSorter / 2);
+		} else {
+			m_sorter.begin(memForSorter);
+		}
 		log_debug() << "After internal sorter begin; mem usage = "
 			<< get_memory_manager().used() << std::endl;
 		std::filesystem::create_directory(m_params.tempDir);
@@ -773,8 +1176,23 @@ public:
 
 		++m_items;
 
+		if (m_selecting) {
+			push_selection(item);
+			return;
+		}
 		if (m_sorter.push(item)) return;
-		end_run();
+		if (m_params.runFormation == run_formation_replacement_selection
+			&& m_sorter.item_count() > 0) {
+			m_files.open_new_writer();
+			m_sorter.begin_selection();
+			m_selecting = true;
+			push_selection(item);
+			return;
+		}
+		if (parallel_run_formation())
+			end_run_in_background();
+		else
+			end_run();
 		if (!m_sorter.push(item)) {
 			throw exception("Couldn't fit a single item in buffer");
 		}
@@ -784,6 +1202,12 @@ public:
 		if (m_state != state_1)
 			throw tpie::exception("Bad state in end");
 
+		if (m_selecting) end_selection();
+		if (parallel_run_formation()) {
+			join_run_writer();
+			m_background.free();
+		}
+
 		memory_size_type internalThreshold =
 			std::min(m_params.memoryPhase2, m_params.memoryPhase3);
 
@@ -818,6 +1242,7 @@ public:
 		} else {
 
 			end_run();
+			m_runCount = m_files.next_level_runs();
 			log_debug() << "Got " << m_files.next_level_runs() << " runs. "
 				<< "External reporting mode." << std::endl;
 			m_sorter.free();
@@ -834,6 +1259,22 @@ public:
 		return m_items;
 	}
 
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief The number of runs formed in phase 1. Zero when reporting
+	/// internally.
+	///////////////////////////////////////////////////////////////////////////
+	stream_size_type run_count() {
+		return m_runCount;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief The number of groups of runs merged at once in each level of
+	/// merge_runs().
+	///////////////////////////////////////////////////////////////////////////
+	memory_size_type concurrent_merges() {
+		return m_concurrentMerges;
+	}
+
 	void evacuate() {
 		switch (m_state) {
 			case state_initial:
@@ -924,15 +1365,39 @@ public:
 			throw exception("Not enough memory for merging.");
 		}
 
+		// Merge several groups of a level at once if the memory and files can
+		// be split between them without adding a merge level.
+		memory_size_type groupMerges = 1;
+		memory_size_type groupFanout = fanout;
+		memory_size_type levels = merge_levels(m_files.next_level_runs(), fanout, finalFanout);
+		memory_size_type maxWorkers = m_params.mergeWorkers;
+		if (maxWorkers == 0) maxWorkers = default_worker_count();
+		for (memory_size_type workers = maxWorkers; workers > 1; --workers) {
+			if (fanoutMemory / workers <= serialization_writer::memory_usage()) continue;
+			memory_size_type f = std::min(
+				(fanoutMemory / workers - serialization_writer::memory_usage()) / perFanout,
+				m_params.filesPhase2 / workers - 1);
+			if (f < 2 || merge_levels(m_files.next_level_runs(), f, finalFanout) > levels) continue;
+			groupMerges = workers;
+			groupFanout = f;
+			break;
+		}
+		m_concurrentMerges = groupMerges;
+
 		log_debug() << "Calculated merge phase parameters for serialization sort.\n"
 			<< "Fanout:       " << fanout << '\n'
 			<< "Final fanout: " << finalFanout << '\n'
+			<< "Concurrent merges: " << groupMerges << " of fanout " << groupFanout << '\n'
 			;
 
 		while (m_files.next_level_runs() > finalFanout) {
 			if (m_files.remaining_runs() != 0)
 				throw exception("m_files.remaining_runs() != 0");
 			log_debug() << "Runs in current level: " << m_files.next_level_runs() << '\n';
+			if (groupMerges > 1) {
+				merge_level_concurrently(groupFanout, groupMerges);
+				continue;
+			}
 			for (size_t remainingRuns = m_files.next_level_runs(); remainingRuns > 0;) {
 				size_t f = std::min(fanout, remainingRuns);
 				merge_runs(f);
@@ -946,15 +1411,115 @@ public:
 	}
 
 private:
+	///////////////////////////////////////////////////////////////////////////
+	/// Replacement selection: write out items of the current run until the
+	/// given item fits in the buffer, and insert it.
+	///////////////////////////////////////////////////////////////////////////
+	void push_selection(const T & item) {
+		while (true) {
+			if (m_sorter.selection_empty()) {
+				if (m_sorter.item_count() == 0)
+					throw exception("Couldn't fit a single item in buffer");
+				m_files.close_writer();
+				m_files.open_new_writer();
+				m_sorter.begin_selection();
+			}
+			T smallest = m_sorter.pop_selection();
+			m_files.write(smallest);
+			if (m_sorter.push_selection(item, !m_pred(item, smallest))) return;
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Replacement selection: finish the current run, leaving the items of
+	/// the next run in the buffer.
+	///////////////////////////////////////////////////////////////////////////
+	void end_selection() {
+		while (!m_sorter.selection_empty())
+			m_files.write(m_sorter.pop_selection());
+		m_files.close_writer();
+		m_sorter.end_selection();
+		m_selecting = false;
+	}
+
 	void end_run() {
-		m_sorter.sort();
-		if (m_sorter.begin() == m_sorter.end()) return;
+		write_run(m_sorter, 1);
+	}
+
+	void write_run(serialization_bits::internal_sort<T, pred_t> & sorter, memory_size_type workers) {
+		sorter.sort();
+		if (sorter.begin() == sorter.end()) return;
 		m_files.open_new_writer();
-		for (const T * item = m_sorter.begin(); item != m_sorter.end(); ++item) {
-			m_files.write(*item);
-		}
+		if (workers > 1)
+			write_slices(sorter, workers);
+		else
+			for (const T * item = sorter.begin(); item != sorter.end(); ++item)
+				m_files.write(*item);
 		m_files.close_writer();
-		m_sorter.reset();
+		sorter.reset();
+	}
+
+	bool parallel_run_formation() const {
+		return m_params.runFormationWorkers > 0
+			&& m_params.runFormation == run_formation_sort;
+	}
+
+	// Serialized bytes per worker in each round of write_slices().
+	static memory_size_type slice_size() {
+		return serialization_writer::block_size();
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Parallel run formation: serialize a sorted run in rounds of one slice
+	/// per worker, each slice holding about slice_size() bytes, and append
+	/// the slices to the run file in order.
+	///////////////////////////////////////////////////////////////////////////
+	void write_slices(serialization_bits::internal_sort<T, pred_t> & sorter, memory_size_type workers) {
+		memory_size_type items = sorter.item_count();
+		memory_size_type itemSize = std::max(sorter.current_serialized_size() / items,
+											 static_cast<memory_size_type>(1));
+		memory_size_type sliceItems = std::max(slice_size() / itemSize,
+											   static_cast<memory_size_type>(1));
+		std::vector<serialization_bits::serialize_slice<T> > slices(workers);
+		const T * next = sorter.begin();
+		while (next != sorter.end()) {
+			memory_size_type used = 0;
+			for (; used < workers && next != sorter.end(); ++used) {
+				const T * end = next + std::min(sliceItems, static_cast<memory_size_type>(sorter.end() - next));
+				slices[used].set_slice(next, end);
+				next = end;
+			}
+			for (memory_size_type i = 1; i < used; ++i) slices[i].enqueue();
+			slices[0]();
+			for (memory_size_type i = 1; i < used; ++i) slices[i].join();
+			for (memory_size_type i = 0; i < used; ++i)
+				m_files.write_serialized(slices[i].data().data(), slices[i].data().size());
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Parallel run formation: hand the full buffer to the background thread
+	/// once it has written the previous run, and continue with its buffer.
+	///////////////////////////////////////////////////////////////////////////
+	void end_run_in_background() {
+		join_run_writer();
+		m_sorter.swap(m_background);
+		m_runWriter = std::thread([this]() {
+			try {
+				write_run(m_background, m_params.runFormationWorkers);
+			} catch (...) {
+				m_runWriterError = std::current_exception();
+			}
+		});
+	}
+
+	void join_run_writer() {
+		if (m_runWriter.joinable()) m_runWriter.join();
+		if (m_runWriterError) {
+			std::exception_ptr e = m_runWriterError;
+			m_runWriterError = nullptr;
+			std::rethrow_exception(e);
+		}
 	}
 
 	void initialize_merger(size_t fanout) {
@@ -968,6 +1533,54 @@ private:
 		m_files.close_readers_and_delete();
 	}
 
+	///////////////////////////////////////////////////////////////////////////
+	/// The number of merge levels needed to bring the given number of runs
+	/// down to the final fanout.
+	///////////////////////////////////////////////////////////////////////////
+	static memory_size_type merge_levels(memory_size_type runs, memory_size_type fanout,
+										 memory_size_type finalFanout) {
+		memory_size_type levels = 0;
+		while (runs > finalFanout) {
+			runs = (runs + fanout - 1) / fanout;
+			++levels;
+		}
+		return levels;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Merge the runs of the next level in groups of the given fanout, with
+	/// up to the given number of groups merged at once by the job manager.
+	///////////////////////////////////////////////////////////////////////////
+	void merge_level_concurrently(size_t fanout, size_t concurrentMerges) {
+		typedef serialization_bits::group_merge<T, pred_t> group_t;
+		size_t remainingRuns = m_files.next_level_runs();
+		while (remainingRuns > 0) {
+			if (remainingRuns == 1) {
+				merge_runs(1);
+				break;
+			}
+			std::vector<std::unique_ptr<group_t> > groups;
+			while (groups.size() < concurrentMerges && remainingRuns > 1) {
+				size_t f = std::min(fanout, remainingRuns);
+				groups.emplace_back(new group_t(m_files, f, m_pred));
+				remainingRuns -= f;
+			}
+			for (size_t i = 0; i < groups.size(); ++i) groups[i]->enqueue();
+			for (size_t i = 0; i < groups.size(); ++i) groups[i]->join();
+			std::exception_ptr error;
+			for (size_t i = 0; i < groups.size(); ++i) {
+				try {
+					groups[i]->finish();
+				} catch (...) {
+					if (!error) error = std::current_exception();
+				}
+			}
+			if (error) std::rethrow_exception(error);
+			if (remainingRuns != m_files.remaining_runs())
+				throw exception("remainingRuns != m_files.remaining_runs()");
+		}
+	}
+
 	void merge_runs(size_t fanout) {
 		if (fanout == 0) throw exception("merge_runs: fanout == 0");
 
@@ -0,0 +1,385 @@
+// -*- mode: c++; tab-width: 4; indent-tabs-mode: t; eval: (progn (c-set-style "stroustrup") (c-set-offset 'innamespace 0)); -*-
+// vi:set ts=4 sts=4 sw=4 noet :
+// Copyright 2026, The TPIE development team
+//
+// This file is part of TPIE.
+//
+// TPIE is free software: you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License as published by the
+// Free Software Foundation, either version 3 of the License, or (at your
+// option) any later version.
+//
+// TPIE is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with TPIE.  If not, see <http://www.gnu.org/licenses/>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \file serialization_string_sort.h  String specific run formation and
+/// merging for serialization_sorter.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TPIE_SERIALIZATION_STRING_SORT_H
+#define TPIE_SERIALIZATION_STRING_SORT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include <tpie/array.h>
+#include <tpie/parallel_sort.h>
+#include <tpie/tpie_assert.h>
+
+namespace tpie {
+
+namespace serialization_bits {
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Whether items of type T ordered by pred_t are byte strings in
+/// lexicographical order.
+///
+/// If so, serialization_sorter forms runs with a multikey quicksort and
+/// merges them with an LCP-aware loser tree, both of which inspect every
+/// character of the common prefixes only once rather than once per
+/// comparison.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename pred_t>
+struct string_sort_traits {
+	static const bool enabled = false;
+};
+
+template <>
+struct string_sort_traits<std::string, std::less<std::string> > {
+	static const bool enabled = true;
+};
+
+template <>
+struct string_sort_traits<std::string, std::less<void> > {
+	static const bool enabled = true;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Sorts the run buffer of internal_sort. By default, the items are
+/// sorted with parallel_sort and no extra memory is used.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename pred_t,
+		  bool enabled = string_sort_traits<T, pred_t>::enabled>
+class run_sorter {
+public:
+	run_sorter(memory_bucket_ref) {}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief Memory used per item of the run buffer in addition to the
+	/// item itself.
+	///////////////////////////////////////////////////////////////////////////
+	static memory_size_type extra_item_size() {
+		return 0;
+	}
+
+	void resize(memory_size_type) {}
+
+	void swap(run_sorter &) {}
+
+	void sort(T * begin, T * end, pred_t pred) {
+		parallel_sort(begin, end, pred);
+	}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Sorts a run buffer of strings with a multikey quicksort.
+///
+/// Each string is represented by a pointer and a cached key holding the
+/// next eight characters after the common prefix of its partition, so that
+/// partitioning does not touch the strings themselves. Partitions of equal
+/// keys advance to the next eight characters. When the order is known, the
+/// strings are moved into place by following the cycles of the permutation.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename pred_t>
+class run_sorter<T, pred_t, true> {
+public:
+	struct entry {
+		std::uint64_t key;
+		const T * item;
+	};
+
+	run_sorter(memory_bucket_ref bucket)
+		: m_entries(bucket)
+	{
+	}
+
+	static memory_size_type extra_item_size() {
+		return sizeof(entry);
+	}
+
+	void resize(memory_size_type n) {
+		m_entries.resize(n);
+	}
+
+	void swap(run_sorter & other) {
+		m_entries.swap(other.m_entries);
+	}
+
+	void sort(T * begin, T * end, pred_t) {
+		memory_size_type n = static_cast<memory_size_type>(end - begin);
+		if (n < 2) return;
+		tp_assert(n <= m_entries.size(), "Run buffer larger than entry array");
+		for (memory_size_type i = 0; i < n; ++i) {
+			m_entries[i].item = begin + i;
+			m_entries[i].key = key_at(begin[i], 0);
+		}
+		multikey_quicksort(m_entries.get(), m_entries.get() + n, 0);
+		permute(begin, n);
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// \brief The eight characters starting at the given depth, big endian
+	/// and padded with zeros, so that keys compare like the characters.
+	///////////////////////////////////////////////////////////////////////////
+	static std::uint64_t key_at(const T & s, memory_size_type depth) {
+		std::uint64_t key = 0;
+		for (memory_size_type i = 0; i < 8; ++i) {
+			key <<= 8;
+			if (depth + i < s.size())
+				key |= static_cast<unsigned char>(s[depth + i]);
+		}
+		return key;
+	}
+
+private:
+	static const memory_size_type insertionSortThreshold = 16;
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Sort [a, b), whose strings share the first depth characters and whose
+	/// keys hold the characters from depth onwards.
+	///////////////////////////////////////////////////////////////////////////
+	static void multikey_quicksort(entry * a, entry * b, memory_size_type depth) {
+		while (b - a > 1) {
+			if (static_cast<memory_size_type>(b - a) < insertionSortThreshold) {
+				insertion_sort(a, b);
+				return;
+			}
+
+			std::uint64_t pivot = median_key(a[0].key, a[(b - a) / 2].key, b[-1].key);
+			entry * lt = std::partition(a, b, [pivot](const entry & e) { return e.key < pivot; });
+			entry * gt = std::partition(lt, b, [pivot](const entry & e) { return e.key == pivot; });
+			multikey_quicksort(a, lt, depth);
+			multikey_quicksort(gt, b, depth);
+
+			// The strings in [lt, gt) agree on the eight characters after
+			// depth. Those that end within them are ordered by length, since
+			// the shorter is a prefix of the longer one up to zero padding,
+			// and come before the strings that continue.
+			memory_size_type next = depth + 8;
+			entry * cont = std::partition(lt, gt, [next](const entry & e) { return e.item->size() <= next; });
+			std::sort(lt, cont, [](const entry & x, const entry & y) {
+				return x.item->size() < y.item->size();
+			});
+			for (entry * e = cont; e != gt; ++e) e->key = key_at(*e->item, next);
+			a = cont;
+			b = gt;
+			depth = next;
+		}
+	}
+
+	static void insertion_sort(entry * a, entry * b) {
+		for (entry * i = a + 1; i < b; ++i) {
+			entry e = *i;
+			entry * j = i;
+			while (j != a && less(e, j[-1])) {
+				*j = j[-1];
+				--j;
+			}
+			*j = e;
+		}
+	}
+
+	static bool less(const entry & x, const entry & y) {
+		if (x.key != y.key) return x.key < y.key;
+		return *x.item < *y.item;
+	}
+
+	static std::uint64_t median_key(std::uint64_t x, std::uint64_t y, std::uint64_t z) {
+		if (x < y) {
+			if (y < z) return y;
+			return x < z ? z : x;
+		}
+		if (x < z) return x;
+		return y < z ? z : y;
+	}
+
+	void permute(T * items, memory_size_type n) {
+		for (memory_size_type i = 0; i < n; ++i) {
+			if (m_entries[i].item == nullptr) continue;
+			memory_size_type src = static_cast<memory_size_type>(m_entries[i].item - items);
+			if (src == i) continue;
+			T tmp = std::move(items[i]);
+			memory_size_type j = i;
+			while (src != i) {
+				items[j] = std::move(items[src]);
+				m_entries[j].item = nullptr;
+				j = src;
+				src = static_cast<memory_size_type>(m_entries[j].item - items);
+			}
+			items[j] = std::move(tmp);
+			m_entries[j].item = nullptr;
+		}
+	}
+
+	array<entry> m_entries;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Merges sorted runs of strings with a loser tree that keeps the
+/// length of the longest common prefix (LCP) of every stored loser with
+/// the winner it lost to.
+///
+/// All LCPs on the path of the last output string are relative to it, so a
+/// match between a candidate and a stored loser is decided by comparing
+/// their LCPs, and characters are only inspected when the LCPs are equal.
+/// The interface matches serialization_bits::merger.
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename pred_t, typename files_t>
+class lcp_merger {
+public:
+	lcp_merger(files_t & files, const pred_t &)
+		: m_files(files)
+		, m_fanout(0)
+		, m_winner(0)
+	{
+	}
+
+	// Assume files.open_readers(fanout) has just been called
+	void init(size_t fanout) {
+		m_fanout = fanout;
+		m_heads.resize(fanout);
+		m_lcp.assign(fanout, 0);
+		m_exhausted.assign(fanout, false);
+		m_loser.assign(fanout, 0);
+		m_loserLcp.assign(fanout, 0);
+		for (size_t i = 0; i < fanout; ++i) {
+			if (m_files.can_read(i))
+				m_files.read(i, m_heads[i]);
+			else
+				m_exhausted[i] = true;
+		}
+
+		// Play the initial matches bottom up. All candidates have LCP zero
+		// with the empty string standing in for the last output.
+		std::vector<size_t> winners(2 * fanout);
+		for (size_t i = 0; i < fanout; ++i) winners[fanout + i] = i;
+		for (size_t node = fanout - 1; node > 0; --node) {
+			size_t candidate = winners[2 * node];
+			m_loser[node] = winners[2 * node + 1];
+			m_loserLcp[node] = 0;
+			play(node, candidate);
+			winners[node] = candidate;
+		}
+		m_winner = fanout == 1 ? 0 : winners[1];
+	}
+
+	bool empty() const {
+		return m_fanout == 0 || m_exhausted[m_winner];
+	}
+
+	const T & top() const {
+		return m_heads[m_winner];
+	}
+
+	void pop() {
+		size_t run = m_winner;
+		if (m_files.can_read(run)) {
+			m_files.read(run, m_next);
+			m_lcp[run] = common_prefix(m_next, m_heads[run], 0);
+			m_heads[run].swap(m_next);
+		} else {
+			m_exhausted[run] = true;
+			T empty;
+			m_heads[run].swap(empty);
+		}
+
+		size_t candidate = run;
+		for (size_t node = (m_fanout + run) / 2; node > 0; node /= 2)
+			play(node, candidate);
+		m_winner = candidate;
+	}
+
+	// files.close_readers_and_delete() should be called after this
+	void free() {
+		std::vector<T>().swap(m_heads);
+		T().swap(m_next);
+		std::vector<size_t>().swap(m_lcp);
+		std::vector<bool>().swap(m_exhausted);
+		std::vector<size_t>().swap(m_loser);
+		std::vector<size_t>().swap(m_loserLcp);
+		m_fanout = 0;
+		m_winner = 0;
+	}
+
+private:
+	static size_t common_prefix(const T & a, const T & b, size_t from) {
+		size_t n = std::min(a.size(), b.size());
+		while (from < n && a[from] == b[from]) ++from;
+		return from;
+	}
+
+	///////////////////////////////////////////////////////////////////////////
+	/// Play the candidate against the loser stored in the node. The winner
+	/// is left in candidate with its LCP relative to the last output in
+	/// m_lcp, and the loser is stored with its LCP relative to the winner.
+	///////////////////////////////////////////////////////////////////////////
+	void play(size_t node, size_t & candidate) {
+		size_t & loser = m_loser[node];
+		size_t & loserLcp = m_loserLcp[node];
+		if (m_exhausted[loser]) return;
+		if (m_exhausted[candidate]) {
+			m_lcp[loser] = loserLcp;
+			std::swap(loser, candidate);
+			return;
+		}
+
+		size_t h = m_lcp[candidate];
+		if (h > loserLcp) return;
+		if (h < loserLcp) {
+			// The stored loser shares more with the last output, so it wins.
+			m_lcp[loser] = loserLcp;
+			std::swap(loser, candidate);
+			loserLcp = h;
+			return;
+		}
+
+		const T & c = m_heads[candidate];
+		const T & l = m_heads[loser];
+		size_t p = common_prefix(c, l, h);
+		bool candidateWins = p == c.size()
+			|| (p < l.size() && static_cast<unsigned char>(c[p]) < static_cast<unsigned char>(l[p]));
+		if (!candidateWins) {
+			m_lcp[loser] = h;
+			std::swap(loser, candidate);
+		}
+		loserLcp = p;
+	}
+
+	files_t & m_files;
+	size_t m_fanout;
+	size_t m_winner;
+	std::vector<T> m_heads;
+	// Buffer the next item of a run is read into, reusing its memory
+	T m_next;
+	// LCP of the head of each run with the last output string
+	std::vector<size_t> m_lcp;
+	std::vector<bool> m_exhausted;
+	// Loser tree: node i in [1, fanout) stores the index of the run that lost
+	// the match in that node, and its LCP with the winner of the match.
+	std::vector<size_t> m_loser;
+	std::vector<size_t> m_loserLcp;
+};
+
+} // namespace serialization_bits
+
+} // namespace tpie
+
+#endif // TPIE_SERIALIZATION_STRING_SORT_H
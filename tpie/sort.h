@@ -41,11 +41,6 @@
 // Get definitions for working with Unix and Windows
 #include <tpie/portability.h>
 
-// The typename that actually does the sorting
-#include <tpie/sort_manager.h>
-#include <tpie/mergeheap.h>
-#include <tpie/internal_sort.h>
-
 #include <tpie/progress_indicator_base.h>
 #include <tpie/progress_indicator_null.h>
 #include <tpie/fractional_progress.h>
@@ -59,49 +54,17 @@ namespace tpie {
 namespace bits {
 
 ///////////////////////////////////////////////////////////////////////////////
-/// \brief Sort elements of a stream in-place using the given STL-style
-/// comparator object.
+/// \brief Sort the elements of instream into outstream using the given
+/// STL-style comparator object.
+///
+/// The elements are sorted by a merge_sorter using all available memory. If
+/// instream and outstream are the same stream, it is truncated as soon as
+/// the sorted runs are formed, so the merges reuse its space on disk.
+/// Otherwise, outstream is truncated before the merges.
 ///////////////////////////////////////////////////////////////////////////////
-template<typename Stream, typename T, typename Compare>
-void generic_sort(Stream & instream, Compare comp,
-				  progress_indicator_base * indicator) {
-
-	stream_size_type sz = instream.size();
-
-	fractional_progress fp(indicator);
-	fractional_subindicator push(fp, "sort", TPIE_FSI, sz, "Write sorted runs");
-	fractional_subindicator merge(fp, "sort", TPIE_FSI, sz, "Perform merge heap");
-	fractional_subindicator output(fp, "sort", TPIE_FSI, sz, "Write sorted output");
-	fp.init(sz);
-
-	instream.seek(0);
-
-	merge_sorter<T, true, Compare> s(comp);
-	s.set_available_memory(get_memory_manager().available());
-	s.begin();
-	push.init(sz);
-	while (instream.can_read()) s.push(instream.read()), push.step();
-	push.done();
-	s.end();
-
-	instream.truncate(0);
-	s.calc(merge);
-
-	output.init(sz);
-	while (s.can_pull()) instream.write(s.pull()), output.step();
-	output.done();
-	fp.done();
-	instream.seek(0);
-}
-
 template<typename Stream, typename T, typename Compare>
 void generic_sort(Stream & instream, Stream & outstream, Compare comp,
-				  progress_indicator_base *indicator) {
-
-	if (&instream == &outstream) {
-		generic_sort<Stream, T, Compare>(instream, comp, indicator);
-		return;
-	}
+				  progress_indicator_base * indicator) {
 
 	stream_size_type sz = instream.size();
 
@@ -115,15 +78,17 @@ void generic_sort(Stream & instream, Stream & outstream, Compare comp,
 
 	merge_sorter<T, true, Compare> s(comp);
 	s.set_available_memory(get_memory_manager().available());
+	// Do not allocate a run buffer larger than the input.
+	s.set_items(sz);
 	s.begin();
 	push.init(sz);
 	while (instream.can_read()) s.push(instream.read()), push.step();
 	push.done();
 	s.end();
 
+	outstream.truncate(0);
 	s.calc(merge);
 
-	outstream.truncate(0);
 	output.init(sz);
 	while (s.can_pull()) outstream.write(s.pull()), output.step();
 	output.done();
@@ -131,8 +96,18 @@ void generic_sort(Stream & instream, Stream & outstream, Compare comp,
 	outstream.seek(0);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Sort elements of a stream in-place using the given STL-style
+/// comparator object.
+///////////////////////////////////////////////////////////////////////////////
+template<typename Stream, typename T, typename Compare>
+void generic_sort(Stream & instream, Compare comp,
+				  progress_indicator_base * indicator) {
+	generic_sort<Stream, T, Compare>(instream, instream, comp, indicator);
 }
 
+} // namespace bits
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief Sort elements of a stream using the given STL-style comparator
 /// object.
@@ -140,7 +115,7 @@ void generic_sort(Stream & instream, Stream & outstream, Compare comp,
 template<typename T, typename Compare>
 void sort(uncompressed_stream<T> &instream, uncompressed_stream<T> &outstream,
 		  Compare comp, progress_indicator_base & indicator) {
-	bits::generic_sort<uncompressed_stream<T>, T, Compare>(instream, outstream, &comp, &indicator);
+	bits::generic_sort<uncompressed_stream<T>, T, Compare>(instream, outstream, comp, &indicator);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -150,7 +125,17 @@ template<typename T>
 void sort(uncompressed_stream<T> &instream, uncompressed_stream<T> &outstream,
 		  tpie::progress_indicator_base* indicator=NULL) {
 	std::less<T> comp;
-	sort(instream, outstream, comp, indicator);
+	bits::generic_sort<uncompressed_stream<T>, T>(instream, outstream, comp, indicator);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief Sort elements of a stream using the given STL-style comparator
+/// object.
+///////////////////////////////////////////////////////////////////////////////
+template<typename T, typename Compare>
+void sort(file_stream<T> &instream, file_stream<T> &outstream,
+		  Compare comp, progress_indicator_base & indicator) {
+	bits::generic_sort<file_stream<T>, T, Compare>(instream, outstream, comp, &indicator);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -178,7 +163,7 @@ void sort(file_stream<T> &instream, file_stream<T> &outstream,
 template<typename T, typename Compare>
 void sort(uncompressed_stream<T> &instream, Compare comp,
 		  progress_indicator_base & indicator) {
-	sort(instream, instream, comp, &indicator);
+	sort(instream, instream, comp, indicator);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -216,6 +201,11 @@ void sort(uncompressed_stream<T> & instream) {
 	sort(instream, instream);
 }
 
+template <typename T>
+void sort(file_stream<T> & instream) {
+	sort(instream, instream);
+}
+
 }  //  tpie namespace
 
 #include <tpie/sort_deprecated.h>